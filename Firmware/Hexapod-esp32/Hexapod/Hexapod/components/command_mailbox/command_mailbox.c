@@ -0,0 +1,106 @@
+#include <stdatomic.h>
+#include <string.h>
+#include "command_mailbox.h"
+
+// Triple buffer: the producer fills states[back], the consumer reads
+// states[front] and `middle` holds the third one, with FRESH set while it is
+// newer than what the consumer has. Both sides swap their buffer with the
+// middle one in a single exchange, so neither can ever see the other's
+// buffer half written.
+#define FRESH   0x4u
+#define INDEX   0x3u
+
+static command_state_t states[3];
+static atomic_uint middle = 1;
+static unsigned back = 0;       // producer only
+static unsigned front = 2;      // consumer only
+
+// producer's command state, published whole on every post
+static command_state_t pending;
+
+// actions[head - tail .. head) are queued, head moved by the producer only,
+// tail by the consumer only
+static command_action_t actions[COMMAND_MAILBOX_ACTIONS];
+static atomic_uint head;
+static atomic_uint tail;
+
+static atomic_uint posted;
+static atomic_uint taken;
+static atomic_uint queued;
+static atomic_uint dropped;
+
+static void publish(void)
+{
+    states[back] = pending;
+    back = atomic_exchange_explicit(&middle, back | FRESH, memory_order_acq_rel) & INDEX;
+    atomic_fetch_add_explicit(&posted, 1, memory_order_relaxed);
+}
+
+void command_mailbox_set_mode(uint8_t mode)
+{
+    pending.mode = mode;
+    pending.mode_seq = ++pending.seq;
+    publish();
+}
+
+void command_mailbox_set_speed(float speed)
+{
+    pending.speed = speed;
+    pending.speed_seq = ++pending.seq;
+    publish();
+}
+
+void command_mailbox_set_pose(const float pose[6])
+{
+    memcpy(pending.pose, pose, sizeof(pending.pose));
+    pending.pose_seq = ++pending.seq;
+    publish();
+}
+
+bool command_mailbox_push(command_action_t action)
+{
+    unsigned h = atomic_load_explicit(&head, memory_order_relaxed);
+    if (h - atomic_load_explicit(&tail, memory_order_acquire) >= COMMAND_MAILBOX_ACTIONS) {
+        atomic_fetch_add_explicit(&dropped, 1, memory_order_relaxed);
+        return false;
+    }
+
+    action.seq = ++pending.seq;
+    actions[h % COMMAND_MAILBOX_ACTIONS] = action;
+    atomic_store_explicit(&head, h + 1, memory_order_release);
+    atomic_fetch_add_explicit(&queued, 1, memory_order_relaxed);
+    return true;
+}
+
+bool command_mailbox_take(command_state_t *state)
+{
+    if (!(atomic_load_explicit(&middle, memory_order_relaxed) & FRESH))
+        return false;
+
+    front = atomic_exchange_explicit(&middle, front, memory_order_acq_rel) & INDEX;
+    *state = states[front];
+    atomic_fetch_add_explicit(&taken, 1, memory_order_relaxed);
+    return true;
+}
+
+bool command_mailbox_pop(command_action_t *action)
+{
+    unsigned t = atomic_load_explicit(&tail, memory_order_relaxed);
+    if (t == atomic_load_explicit(&head, memory_order_acquire))
+        return false;
+
+    *action = actions[t % COMMAND_MAILBOX_ACTIONS];
+    atomic_store_explicit(&tail, t + 1, memory_order_release);
+    return true;
+}
+
+command_mailbox_stats_t command_mailbox_stats(void)
+{
+    command_mailbox_stats_t s = {
+        .posted = atomic_load_explicit(&posted, memory_order_relaxed),
+        .taken = atomic_load_explicit(&taken, memory_order_relaxed),
+        .queued = atomic_load_explicit(&queued, memory_order_relaxed),
+        .dropped = atomic_load_explicit(&dropped, memory_order_relaxed),
+    };
+    return s;
+}
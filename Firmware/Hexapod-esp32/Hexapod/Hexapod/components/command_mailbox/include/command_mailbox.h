@@ -0,0 +1,90 @@
+#pragma once
+
+// Lock-free command mailbox from the web server (httpd task) to the motion
+// task. Exactly one producer and one consumer: every URI handler of the
+// httpd server runs in its task, the motion task takes once per tick.
+//
+// Mode, speed and body pose are latest-wins: the producer publishes its whole
+// command state through a triple buffer, the consumer picks up the newest
+// one, possibly skipping some it never saw. One-shot actions (calibration)
+// go through a bounded queue instead and are applied in order, or dropped
+// and counted when the queue is full.
+//
+//     command_mailbox_set_mode(MOVEMENT_FORWARD);      // httpd task
+//
+//     command_state_t cmd;                             // motion task, each tick
+//     if (command_mailbox_take(&cmd) && cmd.mode_seq != applied.mode_seq) ...
+//
+// Neither side ever waits for the other, a command takes effect on the
+// motion tick that follows it.
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COMMAND_MAILBOX_ACTIONS     16      /*!< queued actions, power of two */
+
+typedef struct {
+    uint32_t seq;           /*!< commands posted, latest-wins ones and actions */
+    uint32_t mode_seq;      /*!< seq of the post that set mode, 0 for never */
+    uint32_t speed_seq;
+    uint32_t pose_seq;
+    uint8_t mode;           /*!< MovementMode */
+    float speed;            /*!< config::minSpeed .. config::maxSpeed */
+    float pose[6];          /*!< roll, pitch, yaw (degrees), x, y, z (mm) */
+} command_state_t;
+
+typedef enum {
+    COMMAND_CAL_START = 1,  /*!< hold the joints for calibration */
+    COMMAND_CAL_OFFSET,     /*!< servo offset of leg, part to value */
+    COMMAND_CAL_SAVE,       /*!< write the offsets to flash, resume walking */
+} command_action_type_t;
+
+typedef struct {
+    uint32_t seq;
+    uint8_t type;           /*!< command_action_type_t */
+    int8_t leg;
+    int8_t part;
+    int16_t value;
+} command_action_t;
+
+typedef struct {
+    uint32_t posted;        /*!< latest-wins commands published */
+    uint32_t taken;         /*!< states the consumer picked up */
+    uint32_t queued;        /*!< actions queued */
+    uint32_t dropped;       /*!< actions lost to a full queue */
+} command_mailbox_stats_t;
+
+// Producer (httpd task)
+
+void command_mailbox_set_mode(uint8_t mode);
+void command_mailbox_set_speed(float speed);
+void command_mailbox_set_pose(const float pose[6]);
+
+/**
+ * @brief Queue a one-shot action, false (and counted) when the queue is full.
+ * action->seq is assigned here.
+ */
+bool command_mailbox_push(command_action_t action);
+
+// Consumer (motion task)
+
+/**
+ * @brief Copy the newest command state to `state`, false when nothing was
+ * posted since the last take (state is left alone).
+ */
+bool command_mailbox_take(command_state_t *state);
+
+/**
+ * @brief Oldest queued action, false when there is none.
+ */
+bool command_mailbox_pop(command_action_t *action);
+
+command_mailbox_stats_t command_mailbox_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
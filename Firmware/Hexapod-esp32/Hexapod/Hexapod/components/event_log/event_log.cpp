@@ -0,0 +1,207 @@
+#include <atomic>
+#include <mutex>
+#include <stdio.h>
+#include <esp_cpu.h>
+#include <esp_timer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "event_log.h"
+
+namespace hexapod {
+namespace event_log {
+
+namespace {
+
+constexpr uint32_t kDepth = 64;                 // records per core, power of two
+constexpr uint32_t kDrainIntervalMs = 100;
+constexpr uint32_t kTaskStack = 4096;
+constexpr UBaseType_t kTaskPriority = 1;        // just above idle
+
+static const char* TAG = "event_log";
+
+struct Record {
+    std::atomic<uint32_t> seq;
+    uint16_t id;
+    uint16_t suppressed;    // repeats of id dropped by the interval before this one
+    uint32_t timeUs;
+    uint32_t words[detail::kMaxWords];
+};
+
+// Bounded MPSC ring: any task or ISR of the core reserves a slot by moving
+// head, writes it and publishes it through seq; drain() is the only reader.
+// A slot is free for position p when seq == p, readable when seq == p + 1.
+struct Ring {
+    Ring() {
+        for (uint32_t i = 0; i < kDepth; i++)
+            records[i].seq.store(i, std::memory_order_relaxed);
+    }
+
+    std::atomic<uint32_t> head{0};
+    uint32_t tail = 0;
+    Record records[kDepth];
+};
+
+Ring rings[portNUM_PROCESSORS];
+
+// rate limit state per event: earliest ms of the next record, repeats since
+std::atomic<uint32_t> nextMs[EVENT_TOTAL];
+std::atomic<uint32_t> pendingSuppressed[EVENT_TOTAL];
+
+std::atomic<uint32_t> recorded{0};
+std::atomic<uint32_t> dropped{0};
+std::atomic<uint32_t> suppressed{0};
+std::atomic<uint32_t> printed{0};
+
+std::mutex drainMutex;
+
+// printf one conversion of `format` per argument word(s), so the arguments
+// never have to go through a va_list
+size_t format(const detail::EventInfo& info, const uint32_t* words, char* out, size_t size) {
+    size_t len = 0;
+    const char* types = info.types;
+    const char* p = info.format;
+
+    auto append = [&](int n) {
+        if (n > 0) len += (size_t)n;
+        if (len >= size) len = size - 1;
+    };
+
+    while (*p && len + 1 < size) {
+        if (*p != '%') {
+            out[len++] = *p++;
+            continue;
+        }
+        if (p[1] == '%') {
+            out[len++] = '%';
+            p += 2;
+            continue;
+        }
+
+        // copy one conversion spec, e.g. "%.2f"
+        char spec[16];
+        size_t n = 0;
+        spec[n++] = *p++;
+        while (*p && n < sizeof(spec) - 1 && !strchr("diuxXfFeEgGsc", *p))
+            spec[n++] = *p++;
+        if (*p && n < sizeof(spec) - 1)
+            spec[n++] = *p++;
+        spec[n] = '\0';
+
+        char type = *types ? *types++ : 'i';
+        if (type == 'f') {
+            float f;
+            memcpy(&f, words++, sizeof(f));
+            append(snprintf(out + len, size - len, spec, (double)f));
+        } else if (type == 's') {
+            const char* s;
+            memcpy(&s, words, sizeof(s));
+            words += detail::wordsOf('s');
+            append(snprintf(out + len, size - len, spec, s));
+        } else {
+            append(snprintf(out + len, size - len, spec, (int)*words++));
+        }
+    }
+    out[len] = '\0';
+    return len;
+}
+
+void drainTask(void*) {
+    for (;;) {
+        drain();
+        vTaskDelay(pdMS_TO_TICKS(kDrainIntervalMs));
+    }
+}
+
+} // namespace
+
+namespace detail {
+
+bool admit(Event id) {
+    uint32_t now = (uint32_t)(esp_timer_get_time() / 1000);
+    uint32_t next = nextMs[id].load(std::memory_order_relaxed);
+    if ((int32_t)(now - next) < 0 ||
+        !nextMs[id].compare_exchange_strong(next, now + kEvents[id].intervalMs, std::memory_order_relaxed)) {
+        pendingSuppressed[id].fetch_add(1, std::memory_order_relaxed);
+        suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    return true;
+}
+
+void write(Event id, const uint32_t* words, int count) {
+    Ring& ring = rings[esp_cpu_get_core_id()];
+
+    uint32_t pos = ring.head.load(std::memory_order_relaxed);
+    Record* r;
+    for (;;) {
+        r = &ring.records[pos & (kDepth - 1)];
+        int32_t diff = (int32_t)(r->seq.load(std::memory_order_acquire) - pos);
+        if (diff == 0) {
+            if (ring.head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        } else if (diff < 0) {
+            // the slot still holds an undrained record from the last lap
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = ring.head.load(std::memory_order_relaxed);
+        }
+    }
+
+    r->id = id;
+    r->suppressed = (uint16_t)pendingSuppressed[id].exchange(0, std::memory_order_relaxed);
+    r->timeUs = (uint32_t)esp_timer_get_time();
+    memcpy(r->words, words, count * sizeof(uint32_t));
+    r->seq.store(pos + 1, std::memory_order_release);
+    recorded.fetch_add(1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+void start() {
+    if (xTaskCreatePinnedToCore(drainTask, "event_log", kTaskStack, nullptr, kTaskPriority, nullptr, tskNO_AFFINITY) != pdPASS)
+        ESP_LOGE(TAG, "Failed to create event log task");
+}
+
+size_t drain() {
+    std::lock_guard<std::mutex> lock(drainMutex);
+
+    size_t count = 0;
+    char line[160];
+    for (Ring& ring : rings) {
+        for (;;) {
+            Record& r = ring.records[ring.tail & (kDepth - 1)];
+            if (r.seq.load(std::memory_order_acquire) != ring.tail + 1)
+                break;
+
+            // copy out and free the slot before the slow part
+            Event id = (Event)r.id;
+            uint16_t skipped = r.suppressed;
+            uint32_t timeUs = r.timeUs;
+            uint32_t words[detail::kMaxWords];
+            memcpy(words, r.words, sizeof(words));
+            r.seq.store(ring.tail + kDepth, std::memory_order_release);
+            ring.tail++;
+
+            const detail::EventInfo& info = detail::kEvents[id];
+            format(info, words, line, sizeof(line));
+            if (skipped) {
+                ESP_LOG_LEVEL(info.level, info.tag, "[%lu.%03lu] %s (+%u suppressed)",
+                    (unsigned long)(timeUs / 1000000), (unsigned long)(timeUs / 1000 % 1000), line, skipped);
+            } else {
+                ESP_LOG_LEVEL(info.level, info.tag, "[%lu.%03lu] %s",
+                    (unsigned long)(timeUs / 1000000), (unsigned long)(timeUs / 1000 % 1000), line);
+            }
+            count++;
+        }
+    }
+    printed.fetch_add(count, std::memory_order_relaxed);
+    return count;
+}
+
+Stats stats() {
+    return Stats{recorded.load(), dropped.load(), suppressed.load(), printed.load()};
+}
+
+} // namespace event_log
+} // namespace hexapod
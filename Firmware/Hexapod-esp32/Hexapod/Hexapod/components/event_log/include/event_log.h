@@ -0,0 +1,140 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <type_traits>
+#include <esp_log.h>
+#include "sdkconfig.h"
+#include "log_events.h"
+
+// Deferred binary logging for the control loop.
+//
+// EVENT_LOG(id, args...) stores the event id, a timestamp and the raw
+// arguments in a lock-free ring of the calling core: no formatting, no UART,
+// no lock, safe from any task or ISR. A low priority task formats and prints
+// the records later. When a ring is full the record is dropped and counted.
+//
+//     EVENT_LOG(SERVO_ANGLE_MAX, leg, angle);
+//
+// Events are declared once in log_events.h. Debug events are compiled out
+// unless CONFIG_HEXAPOD_EVENT_LOG_DEBUG is set. A port without event_log.cpp
+// (STM32) predefines EVENT_LOG_LEVEL as ESP_LOG_NONE to compile out them all.
+
+#ifndef EVENT_LOG_LEVEL
+#if CONFIG_HEXAPOD_EVENT_LOG_DEBUG
+#define EVENT_LOG_LEVEL ESP_LOG_DEBUG
+#else
+#define EVENT_LOG_LEVEL ESP_LOG_INFO
+#endif
+#endif
+
+#define EVENT_LOG(id, ...) ::hexapod::event_log::record<::hexapod::event_log::id>(__VA_ARGS__)
+
+namespace hexapod {
+namespace event_log {
+
+    enum Event : uint16_t {
+#define X(id, level, tag, intervalMs, types, format) id,
+        HEXAPOD_LOG_EVENTS(X)
+#undef X
+        EVENT_TOTAL
+    };
+
+    struct Stats {
+        uint32_t recorded;      // records written to a ring
+        uint32_t dropped;       // ring full
+        uint32_t suppressed;    // repeats inside the event's interval
+        uint32_t printed;       // records formatted by drain()
+    };
+
+    /** @brief Start the drain task (low priority, any core). */
+    void start();
+
+    /**
+     * @brief Format and print every pending record, returns how many.
+     * The drain task calls this; other callers must not run it concurrently.
+     */
+    size_t drain();
+
+    Stats stats();
+
+    namespace detail {
+
+        constexpr int kMaxWords = 8;    // 32 bit argument words per record
+
+        struct EventInfo {
+            esp_log_level_t level;
+            const char* tag;
+            uint32_t intervalMs;
+            const char* types;
+            const char* format;
+        };
+
+        constexpr EventInfo kEvents[EVENT_TOTAL] = {
+#define X(id, level, tag, intervalMs, types, format) { level, tag, intervalMs, types, format },
+            HEXAPOD_LOG_EVENTS(X)
+#undef X
+        };
+
+        // false when the event is inside its interval (counted as suppressed)
+        bool admit(Event id);
+        void write(Event id, const uint32_t* words, int count);
+
+        template <typename T>
+        constexpr char typeOf() {
+            if constexpr (std::is_floating_point_v<T>) return 'f';
+            else if constexpr (std::is_integral_v<T> || std::is_enum_v<T>) return 'i';
+            else return 's';
+        }
+
+        template <typename... Args>
+        constexpr bool typesMatch(const char* types) {
+            const char expected[] = {typeOf<Args>()..., '\0'};
+            size_t i = 0;
+            for (; expected[i]; i++)
+                if (types[i] != expected[i]) return false;
+            return types[i] == '\0';
+        }
+
+        constexpr int wordsOf(char type) {
+            return type == 's' ? (int)(sizeof(const char*) / sizeof(uint32_t)) : 1;
+        }
+
+        template <typename... Args>
+        constexpr int wordCount() {
+            return (0 + ... + wordsOf(typeOf<Args>()));
+        }
+
+        template <typename T>
+        inline void pack(uint32_t*& w, T v) {
+            if constexpr (typeOf<T>() == 'f') {
+                float f = (float)v;
+                memcpy(w++, &f, sizeof(f));
+            } else if constexpr (typeOf<T>() == 'i') {
+                *w++ = (uint32_t)v;
+            } else {
+                const char* s = v;
+                memcpy(w, &s, sizeof(s));
+                w += wordsOf('s');
+            }
+        }
+    }
+
+    template <Event id, typename... Args>
+    inline void record(Args... args) {
+        constexpr detail::EventInfo info = detail::kEvents[id];
+        static_assert(detail::typesMatch<Args...>(info.types), "arguments do not match the event's types");
+        static_assert(detail::wordCount<Args...>() <= detail::kMaxWords, "too many arguments");
+
+        if constexpr (info.level <= EVENT_LOG_LEVEL) {
+            if (info.intervalMs && !detail::admit(id))
+                return;
+            uint32_t words[detail::kMaxWords];
+            uint32_t* w = words;
+            (detail::pack(w, args), ...);
+            detail::write(id, words, (int)(w - words));
+        }
+    }
+}
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+// Events of the deferred log, see event_log.h.
+//
+//   X(id, level, tag, interval ms, argument types, format)
+//
+// Argument types are one letter per argument: i (integer), f (float),
+// s (pointer to a string that lives forever, e.g. a literal). The interval is
+// the minimum time between two records of the event, repeats inside it are
+// only counted. Events above the compiled log level cost nothing.
+
+#define HEXAPOD_LOG_EVENTS(X) \
+    X(SERVO_ANGLE_MAX,  ESP_LOG_INFO,  "SERVO",   500, "if",      "Angle exceeded max[%d]=%.2f") \
+    X(SERVO_ANGLE_MIN,  ESP_LOG_INFO,  "SERVO",   500, "if",      "Angle exceeded min[%d]=%.2f") \
+    X(SERVO_SET,        ESP_LOG_DEBUG, "SERVO",   0,   "ifi",     "Servo[%d] angle=%.2f ticks=%d") \
+    X(LEG_MOVE_TIP,     ESP_LOG_DEBUG, "hexapod", 0,   "iffffff", "leg(%d) moveTip(%f,%f,%f)(%f,%f,%f)") \
+    X(LEG_MOVE,         ESP_LOG_DEBUG, "hexapod", 0,   "ifff",    "leg(%d) move: (%f,%f,%f)") \
+    X(SPEED_SET,        ESP_LOG_INFO,  "hexapod", 0,   "fff",     "运动速度已设置为: %.2f (范围: %.1f - %.1f)") \
+    X(SPEED_LEVEL_SET,  ESP_LOG_INFO,  "hexapod", 0,   "sf",      "速度档位已设置为: %s (%.2f)") \
+    X(SPEED_LEVEL_BAD,  ESP_LOG_INFO,  "hexapod", 0,   "i",       "错误: 无效的速度档位 %d") \
+    X(GAIT_SET,         ESP_LOG_INFO,  "hexapod", 500, "fffi",    "gait: vx=%.1f vy=%.1f yaw=%.1f pattern=%d") \
+    X(CALIBRATION_SET,  ESP_LOG_INFO,  "hexapod", 0,   "iii",     "腿部关节舵机校准: 腿部索引[%d] 关节索引[%d] 偏移量[%d]") \
+    X(COMMAND_MODE,     ESP_LOG_INFO,  "hexapod", 0,   "ii",      "command %d: mode %d") \
+    X(COMMAND_BAD,      ESP_LOG_INFO,  "hexapod", 500, "iii",     "command %d rejected: type %d value %d")
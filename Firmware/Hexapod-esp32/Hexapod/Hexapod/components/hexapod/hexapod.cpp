@@ -1,24 +1,61 @@
-#include <ArduinoJson.h>
-#include <SPIFFS.h>
+#include <cmath>
+#include <esp_timer.h>
+#include <nvs_flash.h>
 
 #include "hexapod.h"
+#include "hexapod_start.h"
+#include "hexapod_metrics.h"
+#include "metrics.h"
+#include "motion_counters.h"
+#include "motion_frame.h"
+#include "motion_task.h"
 #include "servo.h"
+#include "servo_output.h"
 #include "debug.h"
+#include "event_log.h"
 
 namespace hexapod {
 
+    namespace {
+        // servo offsets in µs, an int16_t[6][3] blob
+        const char* kCalibrationNamespace = "hexapod";
+        const char* kCalibrationKey = "calibration";
+
+        uint32_t clockUs() {
+            return (uint32_t)esp_timer_get_time();
+        }
+
+        // The web server initialises NVS too, but the motion stack starts first
+        esp_err_t openCalibration(nvs_open_mode_t mode, nvs_handle_t* handle) {
+            esp_err_t err = nvs_flash_init();
+            if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+                nvs_flash_erase();
+                err = nvs_flash_init();
+            }
+            if (err != ESP_OK)
+                return err;
+            return nvs_open(kCalibrationNamespace, mode, handle);
+        }
+    }
+
     HexapodClass Hexapod;
 
     HexapodClass::HexapodClass(): 
         legs_{{0}, {1}, {2}, {3}, {4}, {5}}, 
         movement_{MOVEMENT_STANDBY},
-        mode_{MOVEMENT_STANDBY}
+        mode_{MOVEMENT_STANDBY},
+        bodyPose_{},
+        command_{},
+        commandMode_{MOVEMENT_STANDBY},
+        calibrating_{false}
     {
 
     }
 
     void HexapodClass::init(bool setting, bool isReset) {
+        event_log::start();
         Servo::init();
+        ServoOutput::start();
 
         calibrationLoad();
 
@@ -32,40 +69,114 @@ namespace hexapod {
         LOG_INFO("Hexapod init done.");
     }
 
-    void HexapodClass::processMovement(MovementMode mode, int elapsed) {
+    void HexapodClass::processMovement(MovementMode mode, uint32_t elapsedUs) {
         if (mode_ != mode) {
             mode_ = mode;
             movement_.setMode(mode_);
         }
 
-        auto& location = movement_.next(elapsed);
-        for(int i=0;i<6;i++) {
-            legs_[i].moveTip(location.get(i));
+        FrameProfile profile{clockUs};
+        motionFrame(movement_, bodyPose_, legs_, elapsedUs, &profile);
+        metrics::record(metrics::FRAME_NEXT, profile.next);
+        metrics::record(metrics::FRAME_POSE, profile.pose);
+        metrics::record(metrics::FRAME_IK, profile.ik);
+        metrics::record(metrics::FRAME_STAGE, profile.stage);
+        metrics::record(metrics::FRAME_COMMIT, profile.commit);
+    }
+
+    MovementMode HexapodClass::getMovementMode() const {
+        return mode_;
+    }
+
+    void HexapodClass::processCommands(uint32_t elapsedUs) {
+        // only what changed since the last take is applied, a speed posted
+        // after the mode does not switch the mode again
+        command_state_t cmd;
+        if (command_mailbox_take(&cmd)) {
+            if (cmd.mode_seq != command_.mode_seq) {
+                if (cmd.mode < MOVEMENT_TOTAL) {
+                    commandMode_ = static_cast<MovementMode>(cmd.mode);
+                    EVENT_LOG(COMMAND_MODE, (int)cmd.mode_seq, (int)cmd.mode);
+                } else {
+                    EVENT_LOG(COMMAND_BAD, (int)cmd.mode_seq, 0, (int)cmd.mode);
+                }
+            }
+            if (cmd.speed_seq != command_.speed_seq)
+                setMovementSpeed(cmd.speed);
+            if (cmd.pose_seq != command_.pose_seq)
+                setBodyPose(BodyPose{cmd.pose[0], cmd.pose[1], cmd.pose[2], cmd.pose[3], cmd.pose[4], cmd.pose[5]});
+            command_ = cmd;
+        }
+
+        command_action_t action;
+        while (command_mailbox_pop(&action))
+            processAction(action);
+
+        if (!calibrating_)
+            processMovement(commandMode_, elapsedUs);
+    }
+
+    void HexapodClass::processAction(const command_action_t& action) {
+        switch (action.type) {
+        case COMMAND_CAL_START:
+            // joints held at their zero angle while the offsets are trimmed
+            calibrating_ = true;
+            calibrationTestAllLeg(0);
+            break;
+        case COMMAND_CAL_OFFSET:
+            // outside calibration the servo would jump off the gait, behind
+            // the leg's cached tip
+            if (!calibrating_ || action.leg < 0 || action.leg >= 6 || action.part < 0 || action.part >= 3) {
+                EVENT_LOG(COMMAND_BAD, (int)action.seq, (int)action.type, (int)action.leg);
+                break;
+            }
+            calibrationSet(action.leg, action.part, action.value);
+            calibrationTest(action.leg, action.part, 0);
+            break;
+        case COMMAND_CAL_SAVE:
+            calibrationSave();
+            calibrating_ = false;
+            // the servos sit at the calibration pose, not at the cached tips:
+            // make the next frame write every joint
+            forceResetAllLegTippos();
+            break;
+        default:
+            EVENT_LOG(COMMAND_BAD, (int)action.seq, (int)action.type, 0);
+            break;
         }
     }
 
+    void HexapodClass::setGait(const GaitParams& params) {
+        movement_.setGait(params);
+        EVENT_LOG(GAIT_SET, params.vx, params.vy, params.yawRate, (int)params.pattern);
+    }
+
+    void HexapodClass::setBodyPose(const BodyPose& pose) {
+        bodyPose_ = pose;
+    }
+
+    const BodyPose& HexapodClass::getBodyPose() const {
+        return bodyPose_;
+    }
+
     void HexapodClass::setMovementSpeed(float speed) {
-        // 受限于舵机频率(50hz->20ms)，速度控制只能是离散的(1/n)
+        // continuous, the gait clock scales elapsed time by the speed
         movement_.setSpeed(speed);
-        char buffer[100]; 
-        snprintf(buffer, sizeof(buffer), "运动速度已设置为: %.2f (范围: %.1f - %.1f)", 
-                 speed, config::minSpeed, config::maxSpeed);
-        LOG_INFO(buffer);
+        EVENT_LOG(SPEED_SET, speed, config::minSpeed, config::maxSpeed);
     }
 
     void HexapodClass::setMovementSpeedLevel(SpeedLevel level) {
         if (level < SPEED_SLOWEST || level > SPEED_FAST) {
-            LOG_INFO("错误: 无效的速度档位");
+            EVENT_LOG(SPEED_LEVEL_BAD, level);
             return;
         }
         
         float speed = speedLevelMultipliers[level];
         setMovementSpeed(speed);
         
-        const char* levelNames[] = {"慢速", "中速", "快速", "最快"};
-        char buffer[100];
-        snprintf(buffer, sizeof(buffer), "速度档位已设置为: %s (%.2f)", levelNames[level], speed);
-        LOG_INFO(buffer);
+        // recorded by pointer, the names must outlive the drain
+        static const char* const levelNames[] = {"慢速", "中速", "快速", "最快"};
+        EVENT_LOG(SPEED_LEVEL_SET, levelNames[level], speed);
     }
 
     float HexapodClass::getMovementSpeed() const {
@@ -73,103 +184,81 @@ namespace hexapod {
     }
 
     void HexapodClass::calibrationSave() {
-        // {"leg1": [0, 0, 0], ..., "leg6: [0, 0, 0]"}
-
-        StaticJsonDocument<512> doc;
-
-        for(int i=0;i<6;i++) {
-            char leg[5];
-            sprintf(leg, "leg%d", i);
-            JsonArray legData = doc.createNestedArray(leg);
-            for(int j=0; j<3; j++) {
-                int offset;
-                legs_[i].get(j)->getParameter(offset);
-                
-                Serial.println(offset);
-                legData.add((short)offset);
+        int16_t offsets[6][3];
+        for (int i = 0; i < 6; i++) {
+            for (int j = 0; j < 3; j++) {
+                offsets[i][j] = (int16_t)lroundf(legs_[i].get(j)->getOffset());
             }
         }
 
-        String output;
-        serializeJson(doc, output);
-        Serial.println(output);
-
-        File file = SPIFFS.open(calibrationFilePath, FILE_WRITE);
-        if (!file) {
-            Serial.println("Failed to open file for writing");
-            return;
+        nvs_handle_t handle;
+        esp_err_t err = openCalibration(NVS_READWRITE, &handle);
+        if (err == ESP_OK) {
+            err = nvs_set_blob(handle, kCalibrationKey, offsets, sizeof(offsets));
+            if (err == ESP_OK)
+                err = nvs_commit(handle);
+            nvs_close(handle);
         }
-
-        if (serializeJson(doc, file) == 0) {
-            Serial.println("Failed to write to file");
+        if (err != ESP_OK) {
+            LOG_WARN("Failed to save the calibration: %s", esp_err_to_name(err));
+            return;
         }
-
-        file.close();
+        LOG_INFO("Calibration saved.");
     }
 
     void HexapodClass::calibrationGet(int legIndex, int partIndex, int& offset) {
-        legs_[legIndex].get(partIndex)->getParameter(offset);
+        offset = (int)lroundf(legs_[legIndex].get(partIndex)->getOffset());
     }
 
     void HexapodClass::calibrationSet(int legIndex, int partIndex, int offset) {
-        char buffer[100]; 
-        snprintf(buffer, sizeof(buffer), "腿部关节舵机校准: 腿部索引[%d] 关节索引[%d] 偏移量[%d]", legIndex, partIndex, offset);
-        LOG_INFO(buffer);
-
-        legs_[legIndex].get(partIndex)->setParameter(offset, false);
-    }
+        EVENT_LOG(CALIBRATION_SET, legIndex, partIndex, offset);
 
-    void HexapodClass::calibrationSet(CalibrationData&  calibrationData) {
-        calibrationSet(calibrationData.legIndex, calibrationData.partIndex, calibrationData.offset);
+        legs_[legIndex].get(partIndex)->setOffset((float)offset);
     }
 
     void HexapodClass::calibrationTest(int legIndex, int partIndex, float angle) {
         legs_[legIndex].get(partIndex)->setAngle(angle);
+        Servo::commit();
     }
 
     void HexapodClass::calibrationTestAllLeg(float angle) {
         for(int i=0; i<6; i++) {
             for(int j=0; j<3; j++) {
-                calibrationTest(i, j, angle);
+                legs_[i].get(j)->setAngle(angle);
             }
         }
+        Servo::commit();
     }
 
     void HexapodClass::calibrationLoad() {
-        File file = SPIFFS.open(calibrationFilePath, FILE_READ);
-        if (!file) {
-            Serial.println("[Warn] Failed to open file for reading. Skipping calibration parameters loading!!!");
-            return;
+        int16_t offsets[6][3];
+        size_t length = sizeof(offsets);
+
+        nvs_handle_t handle;
+        esp_err_t err = openCalibration(NVS_READONLY, &handle);
+        if (err == ESP_OK) {
+            err = nvs_get_blob(handle, kCalibrationKey, offsets, &length);
+            nvs_close(handle);
         }
-
-        StaticJsonDocument<512> doc;
-        DeserializationError error = deserializeJson(doc, file);
-        if (error) {
-            Serial.print("Failed to read file, using default configuration: ");
-            Serial.println(error.c_str());
+        if (err == ESP_OK && length != sizeof(offsets))
+            err = ESP_ERR_NVS_INVALID_LENGTH;
+        if (err != ESP_OK) {
+            LOG_WARN("No calibration loaded (%s), servos keep a zero offset", esp_err_to_name(err));
             return;
         }
-        LOG_INFO("Read Servo Motors Calibration Data:");
-        serializeJson(doc, Serial);
-        Serial.println();
 
         for (int i = 0; i < 6; i++) {
-            char leg[5];
-            sprintf(leg, "leg%d", i);
-            JsonArray legData = doc[leg];
             for (int j = 0; j < 3; j++) {
-                int param = legData[j];
-                legs_[i].get(j)->setParameter(param, true);
+                legs_[i].get(j)->setOffset(offsets[i][j]);
             }
+            LOG_INFO("Calibration leg%d: %d %d %d", i, offsets[i][0], offsets[i][1], offsets[i][2]);
         }
-
-        file.close();
     }
 
     void HexapodClass::clearOffset() {
         for(int i=0; i<6; i++) {
             for(int j=0; j<3; j++) {
-                legs_[i].get(j)->setParameter(0, true);
+                legs_[i].get(j)->setOffset(0);
             }
         }
     }
@@ -182,4 +271,12 @@ namespace hexapod {
         }
     }
 
-}
\ No newline at end of file
+}
+
+void hexapod_start(void) {
+    hexapod_metrics_set_counters(hexapod::formatMotionCounters);
+    hexapod::Hexapod.init(false);
+    hexapod::MotionTask::start([](uint32_t elapsedUs) {
+        hexapod::Hexapod.processCommands(elapsedUs);
+    });
+}
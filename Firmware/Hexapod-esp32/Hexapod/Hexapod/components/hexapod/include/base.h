@@ -68,4 +68,10 @@ namespace hexapod {
     private:
         Point3D points_[6];
     };
-}
+
+    // Joint angles of all six legs in degree, angles[leg][joint].
+    // Joint 0 is the hip (yaw), 1 the femur and 2 the tibia, as in Leg::_inverseKinematics.
+    struct JointAngles {
+        float angles[6][3];
+    };
+}
\ No newline at end of file
@@ -4,19 +4,21 @@ namespace hexapod {
 
     namespace config {
         // all below definition use unit: mm
-        const float kLegMountLeftRightX = 29.87;
-        const float kLegMountOtherX = 22.41;
-        const float kLegMountOtherY = 55.41;
+        constexpr float kLegMountLeftRightX = 29.87;
+        constexpr float kLegMountOtherX = 22.41;
+        constexpr float kLegMountOtherY = 55.41;
         
-        const float kLegRootToJoint1 = 20.75;
-        const float kLegJoint1ToJoint2 = 28.0;
-        const float kLegJoint2ToJoint3 = 42.6;
-        const float kLegJoint3ToTip = 89.07;
+        constexpr float kLegRootToJoint1 = 20.75;
+        constexpr float kLegJoint1ToJoint2 = 28.0;
+        constexpr float kLegJoint2ToJoint3 = 42.6;
+        constexpr float kLegJoint3ToTip = 89.07;
 
 
         // timing setting. unit: ms
         const int movementInterval = 20;
         const int movementSwitchDuration = 150;
+        const int movementIntervalUs = movementInterval * 1000;
+        const int gaitSwingDuration = 200;     // GaitGenerator, one leg's swing
 
         // speed control. range: 0.25 - 1.0 (1.0 is fastest)
         const float defaultSpeed = 0.5;
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <esp_log.h>
+
+// Logging helpers shared by the motion components (leg, movement, hexapod).
+// Format strings must be literals, same as the ESP_LOGx macros they wrap.
+
+#define LOG_TAG "hexapod"
+
+#define LOG_WARN(fmt, ...)  ESP_LOGW(LOG_TAG, fmt, ##__VA_ARGS__)
+#define LOG_INFO(fmt, ...)  ESP_LOGI(LOG_TAG, fmt, ##__VA_ARGS__)
+#define LOG_DEBUG(fmt, ...) ESP_LOGD(LOG_TAG, fmt, ##__VA_ARGS__)
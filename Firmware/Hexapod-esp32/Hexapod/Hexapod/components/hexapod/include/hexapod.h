@@ -2,8 +2,8 @@
 
 #include "movement.h"
 #include "leg.h"
-#include "calibration.h"
 #include "config.h"
+#include "command_mailbox.h"
 
 namespace hexapod {
 
@@ -17,7 +17,22 @@ namespace hexapod {
 
         // Movement API
 
-        void processMovement(MovementMode mode, int elapsed = 0);
+        // elapsedUs since the last frame, 0 completes the current step at once
+        void processMovement(MovementMode mode, uint32_t elapsedUs = 0);
+        MovementMode getMovementMode() const;
+
+        // Command mailbox API, for the motion task once per tick: apply the
+        // newest mode, speed and pose the web server posted and every queued
+        // calibration action, then run the frame (none while calibrating)
+        void processCommands(uint32_t elapsedUs);
+
+        // Walk by velocity with the runtime gait generator, until
+        // processMovement() is given another mode
+        void setGait(const GaitParams& params);
+
+        // Body pose API, applied on top of the gait (and any pose animation)
+        void setBodyPose(const BodyPose& pose);
+        const BodyPose& getBodyPose() const;
 
         // Speed control API
         void setMovementSpeed(float speed);
@@ -26,23 +41,26 @@ namespace hexapod {
 
         // Calibration API
 
-        void calibrationSave(); // write to flash
+        void calibrationSave(); // write the servo offsets to NVS
         void calibrationGet(int legIndex, int partIndex, int& offset);  // read servo setting
         void calibrationSet(int legIndex, int partIndex, int offset);    // update servo setting
-        void calibrationSet(CalibrationData&  calibrationData);
         void calibrationTest(int legIndex, int partIndex, float angle);             // test servo setting
         void calibrationTestAllLeg(float angle);
         void clearOffset();
         void forceResetAllLegTippos();
 
     private:
-        void calibrationLoad(); // read from flash
+        void calibrationLoad(); // read the servo offsets from NVS
+        void processAction(const command_action_t& action);
 
     private:
-        const char* calibrationFilePath = "/calibration.json";
         MovementMode mode_;
         Movement movement_;
+        BodyPose bodyPose_;
         Leg legs_[6];
+        command_state_t command_;   // last state taken from the mailbox
+        MovementMode commandMode_;
+        bool calibrating_;
     };
 
     extern HexapodClass Hexapod;
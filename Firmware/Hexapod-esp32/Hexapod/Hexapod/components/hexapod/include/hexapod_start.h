@@ -0,0 +1,15 @@
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Init the robot (servos, calibration, standby stance) and start the
+ * motion task on core 1, which walks what the command mailbox holds.
+ */
+void hexapod_start(void);
+
+#ifdef __cplusplus
+}
+#endif
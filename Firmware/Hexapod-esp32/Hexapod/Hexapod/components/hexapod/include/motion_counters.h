@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stddef.h>
+
+namespace hexapod {
+
+    /**
+     * @brief Prometheus text of the motion task, servo output, command
+     * mailbox and event log counters into out, truncated to size. Returns
+     * the length. Registered with hexapod_metrics_set_counters() by
+     * hexapod_start(), for the web server's /metrics.
+     */
+    size_t formatMotionCounters(char* out, size_t size);
+
+}
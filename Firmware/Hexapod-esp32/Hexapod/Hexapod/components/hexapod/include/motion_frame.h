@@ -0,0 +1,28 @@
+#pragma once
+
+#include "body_pose.h"
+#include "leg.h"
+#include "movement.h"
+
+namespace hexapod {
+
+    // Stage times of one motionFrame(), in the units of `clock` (the caller's
+    // timer: esp_timer on the ESP32, the cycle counter on the STM32).
+    struct FrameProfile {
+        uint32_t (*clock)();        /*!< set by the caller */
+        uint32_t next = 0;          /*!< Movement::next */
+        uint32_t pose = 0;          /*!< body pose transform of the locations */
+        uint32_t ik = 0;            /*!< joint solve, 0 on a keyframe with table joints */
+        uint32_t stage = 0;         /*!< leg transforms and servo staging */
+        uint32_t commit = 0;        /*!< Servo::commit */
+    };
+
+    // One control frame of the motion core, shared by HexapodClass and the
+    // STM32 controller: advance `movement` by `elapsedUs`, apply the mode's
+    // pose animation and `bodyPose`, solve the joints (or take the table's
+    // pre-solved ones on a keyframe), stage all six legs and commit the servos.
+    // With a `profile`, the time of each stage is stored in it.
+    void motionFrame(Movement& movement, const BodyPose& bodyPose, Leg (&legs)[6], uint32_t elapsedUs,
+                     FrameProfile* profile = nullptr);
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "config.h"
+
+namespace hexapod {
+
+/**
+ * @brief Real-time motion loop, pinned to core 1 (Wi-Fi, lwIP, httpd and
+ * the servo output task stay on core 0).
+ *
+ * A periodic esp_timer gives a semaphore every period, the task wakes on it
+ * and runs one frame with the microseconds since the previous frame. The
+ * timer keeps the deadlines (start + n * period) whatever the frames cost.
+ *
+ * A frame that runs past the next deadline is an overrun. The deadlines it
+ * covered are not replayed one frame each: the next frame runs once, right
+ * away, with the whole gap as its elapsed time, so the gait catches up by
+ * phase and the loop is back on its deadlines after a single late frame.
+ */
+class MotionTask {
+public:
+    using Frame = void (*)(uint32_t elapsedUs);
+
+    struct Stats {
+        uint32_t frames;      /*!< frames run */
+        uint32_t overruns;    /*!< frames that ended past the next deadline */
+        uint32_t missed;      /*!< deadlines skipped while catching up */
+        uint32_t maxLateUs;   /*!< latest wake-up after its deadline */
+        uint32_t maxFrameUs;  /*!< slowest frame */
+    };
+
+    /**
+     * @brief Start the task, `frame` runs every periodUs. No-op when already
+     * running.
+     */
+    static void start(Frame frame, uint32_t periodUs = config::movementIntervalUs);
+
+    /** @brief Stop the timer and wait for the frame in flight */
+    static void stop();
+
+    static bool running();
+
+    static Stats stats();
+};
+
+} // namespace hexapod
@@ -0,0 +1,47 @@
+#include <stdio.h>
+#include "command_mailbox.h"
+#include "event_log.h"
+#include "motion_counters.h"
+#include "motion_task.h"
+#include "servo_output.h"
+
+namespace hexapod {
+
+size_t formatMotionCounters(char* out, size_t size) {
+    MotionTask::Stats motion = MotionTask::stats();
+    ServoOutput::Stats servo = ServoOutput::stats();
+    command_mailbox_stats_t mailbox = command_mailbox_stats();
+    event_log::Stats log = event_log::stats();
+
+    struct Counter {
+        const char* name;
+        const char* type;
+        uint32_t value;
+    };
+    const Counter counters[] = {
+        {"hexapod_motion_frames_total",     "counter", motion.frames},
+        {"hexapod_motion_overruns_total",   "counter", motion.overruns},
+        {"hexapod_motion_missed_total",     "counter", motion.missed},
+        {"hexapod_motion_max_late_us",      "gauge",   motion.maxLateUs},
+        {"hexapod_motion_max_frame_us",     "gauge",   motion.maxFrameUs},
+        {"hexapod_servo_submitted_total",   "counter", servo.submitted},
+        {"hexapod_servo_merged_total",      "counter", servo.merged},
+        {"hexapod_servo_written_total",     "counter", servo.written},
+        {"hexapod_servo_errors_total",      "counter", servo.errors},
+        {"hexapod_command_posted_total",    "counter", mailbox.posted},
+        {"hexapod_command_taken_total",     "counter", mailbox.taken},
+        {"hexapod_command_dropped_total",   "counter", mailbox.dropped},
+        {"hexapod_event_log_dropped_total", "counter", log.dropped},
+    };
+
+    size_t len = 0;
+    for (const Counter& c : counters) {
+        int n = snprintf(out + len, size - len, "# TYPE %s %s\n%s %lu\n",
+            c.name, c.type, c.name, (unsigned long)c.value);
+        if (n > 0) len += (size_t)n;
+        if (len >= size) return size - 1;
+    }
+    return len;
+}
+
+} // namespace hexapod
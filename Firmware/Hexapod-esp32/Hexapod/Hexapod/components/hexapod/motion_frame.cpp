@@ -0,0 +1,51 @@
+#include "motion_frame.h"
+#include "body_kinematics.h"
+#include "servo.h"
+
+namespace hexapod {
+
+    void motionFrame(Movement& movement, const BodyPose& bodyPose, Leg (&legs)[6], uint32_t elapsedUs,
+                     FrameProfile* profile) {
+        auto stamp = [profile]() { return profile ? profile->clock() : 0u; };
+        uint32_t start = stamp();
+
+        const Locations* location = &movement.next(elapsedUs);
+        uint32_t nextAt = stamp();
+
+        // body pose (user pose after the mode's pose animation) in one pass
+        Locations posed;
+        const BodyPose& gaitPose = movement.pose();
+        bool hasPose = !bodyPose.isIdentity() || !gaitPose.isIdentity();
+        if (hasPose) {
+            posed = (PoseTransform(bodyPose) * PoseTransform(gaitPose)).apply(*location);
+            location = &posed;
+        }
+
+        uint32_t posedAt = stamp();
+
+        // frames landing on a keyframe come pre-solved from the table, frames
+        // interpolated between keyframes or moved by a pose go through IK
+        JointAngles solved;
+        const JointAngles* angles = hasPose ? nullptr : movement.angles();
+        if (!angles) {
+            BodyKinematics::solve(*location, solved);
+            angles = &solved;
+        }
+        uint32_t solvedAt = stamp();
+
+        for(int i=0;i<6;i++) {
+            legs[i].moveTipSolved(location->get(i), angles->angles[i]);
+        }
+        uint32_t stagedAt = stamp();
+        Servo::commit();
+
+        if (profile) {
+            profile->next = nextAt - start;
+            profile->pose = posedAt - nextAt;
+            profile->ik = solvedAt - posedAt;
+            profile->stage = stagedAt - solvedAt;
+            profile->commit = profile->clock() - stagedAt;
+        }
+    }
+
+}
@@ -0,0 +1,142 @@
+#include <atomic>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "metrics.h"
+#include "motion_task.h"
+
+namespace hexapod {
+
+namespace {
+
+constexpr uint32_t kTaskStack = 6144;
+constexpr UBaseType_t kTaskPriority = 9;        // highest task on core 1, only event_log (1) shares it
+constexpr BaseType_t kTaskCore = 1;             // Wi-Fi, lwIP and httpd run on core 0
+constexpr UBaseType_t kMaxPending = 16;         // deadlines counted while a frame overruns
+
+static const char* TAG = "MOTION";
+
+MotionTask::Frame frameFn;
+int64_t period;
+int64_t origin;                 // µs the timer started at, deadline n is origin + n * period
+
+esp_timer_handle_t timer;
+SemaphoreHandle_t tick;         // timer -> task, one per deadline
+SemaphoreHandle_t taskExited;   // task -> stop()
+
+std::atomic<bool> isRunning{false};
+std::atomic<bool> stopping{false};
+
+std::atomic<uint32_t> frames{0};
+std::atomic<uint32_t> overruns{0};
+std::atomic<uint32_t> missed{0};
+std::atomic<uint32_t> maxLateUs{0};
+std::atomic<uint32_t> maxFrameUs{0};
+
+void onTimer(void*) {
+    xSemaphoreGive(tick);
+}
+
+inline void raise(std::atomic<uint32_t>& max, uint32_t value) {
+    if (value > max.load(std::memory_order_relaxed))
+        max.store(value, std::memory_order_relaxed);
+}
+
+void motionTask(void*) {
+    int64_t last = origin;
+    int64_t lastDeadline = 0;
+    for (;;) {
+        xSemaphoreTake(tick, portMAX_DELAY);
+        if (stopping)
+            break;
+        while (xSemaphoreTake(tick, 0) == pdTRUE)
+            ;
+
+        // the deadline this wake-up is for, counted on the clock rather than
+        // by the ticks, which the esp_timer task may hand over late
+        int64_t now = esp_timer_get_time();
+        int64_t deadline = (now - origin) / period;
+        if (deadline == lastDeadline)
+            continue;   // a tick delivered after its deadline was served
+
+        // deadlines that passed while the previous frame ran are folded into
+        // this one: one frame, the whole gap as elapsed time
+        missed += (uint32_t)(deadline - lastDeadline - 1);
+        lastDeadline = deadline;
+        int64_t deadlineAt = origin + deadline * period;
+        uint32_t lateUs = (uint32_t)(now - deadlineAt);
+        raise(maxLateUs, lateUs);
+        metrics::record(metrics::FRAME_JITTER, lateUs);
+
+        frameFn((uint32_t)(now - last));
+        last = now;
+
+        int64_t end = esp_timer_get_time();
+        raise(maxFrameUs, (uint32_t)(end - now));
+        metrics::record(metrics::FRAME_LATENCY, (uint32_t)(end - deadlineAt));
+        if (end - origin >= (deadline + 1) * period)
+            overruns++;
+        frames++;
+    }
+
+    xSemaphoreGive(taskExited);
+    vTaskDelete(NULL);
+}
+
+} // namespace
+
+void MotionTask::start(Frame frame, uint32_t periodUs) {
+    if (isRunning)
+        return;
+
+    frameFn = frame;
+    period = periodUs;
+    tick = xSemaphoreCreateCounting(kMaxPending, 0);
+    taskExited = xSemaphoreCreateBinary();
+
+    esp_timer_create_args_t args = {};
+    args.callback = onTimer;
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = "motion";
+    ESP_ERROR_CHECK(esp_timer_create(&args, &timer));
+
+    stopping = false;
+    isRunning = true;
+    origin = esp_timer_get_time();
+    ESP_ERROR_CHECK(esp_timer_start_periodic(timer, period));
+    if (xTaskCreatePinnedToCore(motionTask, "motion", kTaskStack, nullptr, kTaskPriority, nullptr, kTaskCore) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create motion task");
+        isRunning = false;
+        esp_timer_stop(timer);
+        esp_timer_delete(timer);
+        vSemaphoreDelete(tick);
+        vSemaphoreDelete(taskExited);
+    }
+}
+
+void MotionTask::stop() {
+    if (!isRunning)
+        return;
+
+    esp_timer_stop(timer);
+    esp_timer_delete(timer);
+    stopping = true;
+    xSemaphoreGive(tick);
+    xSemaphoreTake(taskExited, portMAX_DELAY);
+    isRunning = false;
+
+    vSemaphoreDelete(tick);
+    vSemaphoreDelete(taskExited);
+}
+
+bool MotionTask::running() {
+    return isRunning;
+}
+
+MotionTask::Stats MotionTask::stats() {
+    return Stats{frames, overruns, missed, maxLateUs, maxFrameUs};
+}
+
+} // namespace hexapod
@@ -0,0 +1,41 @@
+#include "body_kinematics.h"
+#include "config.h"
+#include "kinematics.h"
+#include "leg_geometry.h"
+#include "reachability.h"
+
+namespace hexapod {
+
+    namespace {
+
+        // Six legs padded to a multiple of the host vector width, the two spare
+        // lanes repeat leg 0 and are dropped. ESP32-S3 PIE has no float lanes,
+        // so on target this stays a straight-line FPU pass without call overhead.
+        constexpr int kLanes = 8;
+    }
+
+    void BodyKinematics::solve(const Locations& world, JointAngles& out) {
+        float x[kLanes], y[kLanes], z[kLanes];
+        float a0[kLanes], a1[kLanes], a2[kLanes];
+
+        for (int i = 0; i < kLanes; i++) {
+            const int leg = i < 6 ? i : 0;
+            const Point3D& p = world.get(leg);
+            geometry::toLocal(geometry::kLegMounts[leg], p.x_, p.y_, x[i], y[i]);
+            z[i] = p.z_;
+        }
+
+        for (int i = 0; i < 6; i++)
+            reachability::clamp(x[i], y[i], z[i]);
+
+        for (int i = 0; i < kLanes; i++)
+            kinematics::inverse(x[i], y[i], z[i], a0[i], a1[i], a2[i]);
+
+        for (int i = 0; i < 6; i++) {
+            out.angles[i][0] = a0[i];
+            out.angles[i][1] = a1[i];
+            out.angles[i][2] = a2[i];
+        }
+    }
+
+}
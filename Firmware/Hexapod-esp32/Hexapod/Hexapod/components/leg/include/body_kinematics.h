@@ -0,0 +1,20 @@
+#pragma once
+
+#include "base.h"
+
+namespace hexapod {
+
+    // Whole body inverse kinematics.
+    //
+    // Converts a Locations frame (world coordinates) into structure-of-arrays
+    // x/y/z lanes, applies every leg's mount transform and solves all legs in
+    // one pass with the kernel selected by CONFIG_HEXAPOD_FAST_IK. Results
+    // are identical to Leg::translateToLocal + Leg::_inverseKinematics per leg.
+    // Targets outside a leg's workspace are moved to the nearest reachable
+    // point first (see reachability.h), so the output never holds NaN.
+    class BodyKinematics {
+    public:
+        static void solve(const Locations& world, JointAngles& out);
+    };
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Single precision approximations used by the fast IK kernel (CONFIG_HEXAPOD_FAST_IK).
+//
+// Maximum absolute error over the whole input domain, against libm in double:
+//   atan2  1.2e-5 rad (0.0007 deg)   odd minimax polynomial, degree 9, octant reduction
+//   acos   7.5e-5 rad (0.0043 deg)   Abramowitz & Stegun 4.4.45 (6.8e-5) + float rsqrt
+//   rsqrt  4.7e-6 relative           bit estimate + 2 Newton steps
+//
+// Hip and knee angles combine up to two acos and one atan2, so a joint angle is
+// off by at most ~0.01 deg, far below one PCA9685 tick (~0.44 deg at 50 Hz).
+// Run `hexapod_bench --accuracy` (host/) to re-check after changing anything here.
+
+namespace hexapod {
+
+    namespace fastmath {
+
+        constexpr float kPi = 3.14159265358979f;
+        constexpr float kHalfPi = kPi / 2;
+        constexpr float kRadToDeg = 180.0f / kPi;
+        constexpr float kDegToRad = kPi / 180.0f;
+
+        // 1/sqrt(x) for x >= 0. Finite for x == 0, so x * rsqrt(x) is a valid sqrt(0).
+        inline float rsqrt(float x) {
+            uint32_t i;
+            std::memcpy(&i, &x, sizeof(i));
+            i = 0x5f375a86 - (i >> 1);
+            float y;
+            std::memcpy(&y, &i, sizeof(y));
+            float hx = 0.5f * x;
+            y = y * (1.5f - hx * y * y);
+            y = y * (1.5f - hx * y * y);
+            return y;
+        }
+
+        inline float sqrt(float x) {
+            return x * rsqrt(x);
+        }
+
+        // Branch free (selects only), so loops over several legs can vectorize.
+        inline float atan2(float y, float x) {
+            float ax = std::fabs(x);
+            float ay = std::fabs(y);
+            float hi = ax > ay ? ax : ay;
+            float lo = ax > ay ? ay : ax;
+
+            float t = lo / (hi > 0.0f ? hi : 1.0f);
+            float t2 = t * t;
+            float r = t * (0.99986633f + t2 * (-0.33030477f + t2 * (0.18015924f + t2 * (-0.08515627f + t2 * 0.02084507f))));
+
+            r = ay > ax ? kHalfPi - r : r;
+            r = x < 0.0f ? kPi - r : r;
+            return y < 0.0f ? -r : r;
+        }
+
+        // NaN outside [-1, 1] like std::acos, so unreachable targets still show up as NaN.
+        inline float acos(float x) {
+            float ax = std::fabs(x);
+            float s = 1.0f - ax;
+            float r = sqrt(s > 0.0f ? s : 0.0f) * (1.5707288f + ax * (-0.2121144f + ax * (0.0742610f + ax * -0.0187293f)));
+            r = x < 0.0f ? kPi - r : r;
+            return ax <= 1.0f ? r : NAN;
+        }
+    }
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cmath>
+
+#include "config.h"
+#include "fast_math.h"
+#include "sdkconfig.h"
+
+// Leg inverse kinematics kernels, leg local coordinates in mm, angles in degree.
+// Scalar in, scalar out and inline, so Leg can call them per point and
+// BodyKinematics can run them over structure-of-arrays lanes.
+
+namespace hexapod {
+
+    namespace kinematics {
+
+        inline void inverseLibm(float tx, float ty, float tz, float& a0, float& a1, float& a2) {
+            using namespace config;
+            constexpr float pi = fastmath::kPi;
+
+            float x = tx - kLegRootToJoint1;
+            float y = ty;
+
+            a0 = std::atan2(y, x) * 180 / pi;
+
+            x = std::sqrt(x*x + y*y) - kLegJoint1ToJoint2;
+            y = tz;
+            float ar = std::atan2(y, x);
+            float lr2 = x*x + y*y;
+            float lr = std::sqrt(lr2);
+            float c1 = std::acos((lr2 + kLegJoint2ToJoint3*kLegJoint2ToJoint3 - kLegJoint3ToTip*kLegJoint3ToTip)/(2*kLegJoint2ToJoint3*lr));
+            float c2 = std::acos((lr2 - kLegJoint2ToJoint3*kLegJoint2ToJoint3 + kLegJoint3ToTip*kLegJoint3ToTip)/(2*kLegJoint3ToTip*lr));
+            a1 = (ar + c1) * 180 / pi;
+            a2 = 90 - ((c1 + c2)  * 180 / pi);
+        }
+
+        inline void inverseFast(float tx, float ty, float tz, float& a0, float& a1, float& a2) {
+            using namespace config;
+            using namespace fastmath;
+
+            const float l2Sq = kLegJoint2ToJoint3*kLegJoint2ToJoint3;
+            const float l3Sq = kLegJoint3ToTip*kLegJoint3ToTip;
+
+            float x = tx - kLegRootToJoint1;
+            float y = ty;
+
+            a0 = fastmath::atan2(y, x) * kRadToDeg;
+
+            x = fastmath::sqrt(x*x + y*y) - kLegJoint1ToJoint2;
+            y = tz;
+            float ar = fastmath::atan2(y, x);
+            float lr2 = x*x + y*y;
+            float invLr = rsqrt(lr2);
+            float c1 = fastmath::acos((lr2 + l2Sq - l3Sq) * invLr * (0.5f / kLegJoint2ToJoint3));
+            float c2 = fastmath::acos((lr2 - l2Sq + l3Sq) * invLr * (0.5f / kLegJoint3ToTip));
+            a1 = (ar + c1) * kRadToDeg;
+            a2 = 90 - (c1 + c2) * kRadToDeg;
+        }
+
+        // The kernel selected by CONFIG_HEXAPOD_FAST_IK
+        inline void inverse(float tx, float ty, float tz, float& a0, float& a1, float& a2) {
+#if CONFIG_HEXAPOD_FAST_IK
+            inverseFast(tx, ty, tz, a0, a1, a2);
+#else
+            inverseLibm(tx, ty, tz, a0, a1, a2);
+#endif
+        }
+    }
+}
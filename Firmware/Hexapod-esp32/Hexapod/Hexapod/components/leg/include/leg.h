@@ -1 +1,70 @@
-void func(void);
+#pragma once
+
+#include "base.h"
+#include "leg_geometry.h"
+#include "servo.h"
+
+namespace hexapod {
+
+    class Leg {
+    public:
+        Leg(int legIndex);
+        ~Leg();
+
+        Leg(const Leg&) = delete;
+        Leg& operator=(const Leg&) = delete;
+
+        // Joint API
+
+        void setJointAngle(float angle[3]);
+
+        // Tip API (world coordinate)
+
+        void moveTip(const Point3D& to);
+        const Point3D& getTipPosition(void);
+
+        // moveTip() with joint angles already solved for `to` (see BodyKinematics)
+        void moveTipSolved(const Point3D& to, const float angles[3]);
+
+        // Tip API (leg local coordinate)
+
+        void moveTipLocal(const Point3D& to);
+        const Point3D& getTipPositionLocal(void);
+
+        // Coordinate conversion
+
+        void translateToLocal(const Point3D& world, Point3D& local) { geometry::toLocal(mount_, world, local); }
+        void translateToWorld(const Point3D& local, Point3D& world) { geometry::toWorld(mount_, local, world); }
+
+        // Servo access (calibration)
+
+        Servo* get(int partIndex) { return servos_[partIndex]; }
+
+        // Invalidate the cached tip so the next moveTip() always drives the servos
+        void forceResetTipPosition(void) {
+            tipPos_ = Point3D(0, 0, 0);
+            tipPosLocal_ = Point3D(0, 0, 0);
+        }
+
+        // Kinematics (leg local coordinate, angles in degree)
+
+        static void _forwardKinematics(float angle[3], Point3D& out);
+        static void _inverseKinematics(const Point3D& to, float angles[3]);
+
+        // IK kernels, both always built. CONFIG_HEXAPOD_FAST_IK selects the one
+        // _inverseKinematics() uses (see fast_math.h for the error bounds).
+        static void _inverseKinematicsLibm(const Point3D& to, float angles[3]);
+        static void _inverseKinematicsFast(const Point3D& to, float angles[3]);
+
+    private:
+        void _move(const Point3D& to);
+
+    private:
+        int index_;
+        Servo* servos_[3];
+        const LegMount& mount_;
+        Point3D tipPos_ {};
+        Point3D tipPosLocal_ {};
+    };
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "base.h"
+#include "config.h"
+
+// Leg mount geometry, known at compile time.
+//
+// Each leg's local frame sits at its mount point with +X pointing away from
+// the body, rotated `angle` CCW from the body +X axis:
+//
+//     local = R(-angle) * (world - mount)
+//     world = R(angle) * local + mount
+//
+// The 45 degree terms use 0.7071 like pathTool/src/config.py, so generated
+// tables and runtime transforms agree on the stance.
+
+namespace hexapod {
+
+    struct LegMount {
+        float x;
+        float y;
+        float cos;      // cos(angle)
+        float sin;      // sin(angle)
+    };
+
+    namespace geometry {
+
+        constexpr float kSin45 = 0.7071f;
+        constexpr float kCos45 = 0.7071f;
+
+        constexpr LegMount kLegMounts[6] = {
+            { config::kLegMountOtherX,      config::kLegMountOtherY,   kCos45,  kSin45 },   // 45 degree
+            { config::kLegMountLeftRightX,  0,                          1,       0      },   // 0 degree
+            { config::kLegMountOtherX,      -config::kLegMountOtherY,  kCos45,  -kSin45 },  // 315 degree
+            { -config::kLegMountOtherX,     -config::kLegMountOtherY,  -kCos45, -kSin45 },  // 225 degree
+            { -config::kLegMountLeftRightX, 0,                          -1,      0      },   // 180 degree
+            { -config::kLegMountOtherX,     config::kLegMountOtherY,   -kCos45, kSin45 },   // 135 degree
+        };
+
+        // Leg and BodyKinematics both go through these, so per-leg and whole
+        // body solves see bit identical local points.
+
+        inline void toLocal(const LegMount& m, float wx, float wy, float& lx, float& ly) {
+            float dx = wx - m.x;
+            float dy = wy - m.y;
+            lx = dx * m.cos + dy * m.sin;
+            ly = dy * m.cos - dx * m.sin;
+        }
+
+        inline void toLocal(const LegMount& m, const Point3D& world, Point3D& local) {
+            toLocal(m, world.x_, world.y_, local.x_, local.y_);
+            local.z_ = world.z_;
+        }
+
+        inline void toWorld(const LegMount& m, const Point3D& local, Point3D& world) {
+            world.x_ = local.x_ * m.cos - local.y_ * m.sin + m.x;
+            world.y_ = local.x_ * m.sin + local.y_ * m.cos + m.y;
+            world.z_ = local.z_;
+        }
+    }
+}
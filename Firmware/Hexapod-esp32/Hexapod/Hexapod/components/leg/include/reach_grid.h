@@ -0,0 +1,406 @@
+//
+// This file is generated, dont directly modify content...
+//
+// leg reach grid: 67x79 cells of 3.0 mm, 1256 inside, 269 boundary
+constexpr float kReachCell = 3.0f;
+constexpr float kReachOriginR = -66.0f;
+constexpr float kReachOriginZ = -126.0f;
+constexpr int kReachCols = 67;
+constexpr int kReachRows = 79;
+constexpr float kReachYawTan = 1.000000f;
+constexpr float kJointLimits[3][2] { {-45, 45}, {-45, 75}, {-60, 60} };
+
+// 2 bits per cell, row major from (origin r, origin z): 0 outside, 1 inside, 2 boundary
+const uint8_t kReachState[] {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xaa, 0xaa, 0xaa, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x6a, 0x55, 0x55, 0x95, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x6a, 0x55, 0x55, 0x55, 0x55, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x95, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x0a, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x0a, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x95, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x02, 0x00, 0x00, 0x00, 0x00, 0x80,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x02, 0x00, 0x00, 0x00, 0x00, 0x60, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x80, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x25, 0x00, 0x00, 0x00, 0x00, 0x60, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x29,
+    0x00, 0x00, 0x00, 0x00, 0x58, 0xa9, 0xaa, 0xaa, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0xa6, 0x02, 0x00,
+    0x80, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x0a, 0x00, 0x00, 0x00, 0x80, 0x0a, 0x00, 0x00, 0x00, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xa0, 0x5a, 0x55, 0x55, 0x55, 0x55, 0x55, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x55, 0x55, 0x55, 0x55, 0x55, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x56, 0x55, 0x55, 0x55, 0x55, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x55, 0x55, 0x95,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x55, 0x55, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x55, 0x55, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55,
+    0x55, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x55, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x56, 0x55, 0x55, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x55, 0x55, 0x55, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x55, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa0, 0x55, 0x55, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x55, 0x55, 0x25,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x55, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5a, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
+    0x55, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x55, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x60, 0x55, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x55, 0xa5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x55, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x56, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x55, 0x95, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x55, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56,
+    0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x55, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x58, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x29, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x55, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x58, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x95, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x29, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x68, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x80, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa8, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xa0, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+
+// nearest inside cell of every cell
+const uint16_t kReachNearest[] {
+    683, 683, 683, 683, 617, 617, 551, 551, 485, 485, 485, 485, 485, 485, 420, 420,
+    420, 355, 355, 355, 291, 291, 291, 291, 227, 227, 227, 228, 229, 230, 231, 232,
+    233, 234, 235, 236, 237, 238, 238, 238, 308, 308, 308, 308, 377, 377, 377, 377,
+    514, 514, 514, 514, 514, 514, 719, 719, 719, 719, 719, 719, 719, 787, 787, 855,
+    855, 923, 923, 683, 683, 683, 683, 683, 617, 617, 551, 551, 485, 485, 485, 485,
+    485, 485, 420, 420, 355, 355, 355, 355, 291, 291, 291, 227, 227, 227, 228, 229,
+    230, 231, 232, 233, 234, 235, 236, 237, 238, 238, 238, 308, 308, 308, 377, 377,
+    377, 377, 514, 514, 514, 514, 514, 514, 719, 719, 719, 719, 719, 719, 719, 787,
+    787, 855, 855, 923, 923, 991, 683, 683, 683, 683, 683, 683, 617, 617, 551, 551,
+    485, 485, 485, 485, 485, 420, 420, 420, 355, 355, 355, 291, 291, 291, 292, 227,
+    227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 238, 307, 308, 308,
+    308, 377, 377, 377, 377, 514, 514, 514, 514, 514, 582, 719, 719, 719, 719, 719,
+    719, 787, 787, 855, 855, 923, 923, 991, 991, 683, 683, 683, 683, 683, 683, 683,
+    617, 617, 551, 551, 485, 485, 485, 485, 485, 420, 420, 355, 355, 355, 356, 291,
+    291, 292, 227, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 238,
+    307, 308, 308, 377, 377, 377, 377, 514, 514, 514, 514, 514, 582, 719, 719, 719,
+    719, 719, 719, 787, 787, 855, 855, 923, 923, 991, 991, 991, 683, 683, 683, 683,
+    683, 683, 683, 683, 617, 617, 551, 551, 485, 485, 485, 485, 420, 420, 420, 355,
+    355, 356, 291, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303,
+    304, 305, 306, 307, 308, 308, 377, 377, 377, 445, 514, 514, 514, 514, 582, 719,
+    719, 719, 719, 719, 719, 787, 787, 855, 855, 923, 923, 991, 991, 991, 991, 683,
+    683, 683, 683, 683, 683, 683, 683, 683, 617, 617, 551, 551, 485, 485, 485, 485,
+    420, 420, 355, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367,
+    368, 369, 370, 371, 372, 373, 374, 375, 376, 377, 377, 445, 514, 514, 514, 514,
+    582, 582, 719, 719, 719, 719, 719, 787, 787, 855, 855, 923, 923, 991, 991, 991,
+    991, 991, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 617, 617, 551, 551,
+    485, 485, 485, 420, 420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431,
+    432, 433, 434, 435, 436, 437, 438, 439, 440, 441, 442, 443, 444, 445, 445, 514,
+    514, 514, 582, 582, 719, 719, 719, 719, 719, 787, 787, 855, 855, 923, 923, 991,
+    991, 991, 991, 991, 991, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683,
+    617, 617, 551, 551, 485, 485, 486, 487, 488, 489, 490, 491, 492, 493, 494, 495,
+    496, 497, 498, 499, 500, 501, 502, 503, 504, 505, 506, 507, 508, 509, 510, 511,
+    512, 513, 514, 514, 582, 582, 650, 719, 719, 719, 719, 787, 787, 855, 855, 923,
+    923, 991, 991, 991, 991, 991, 991, 991, 683, 683, 683, 683, 683, 683, 683, 683,
+    683, 683, 683, 683, 617, 617, 551, 551, 552, 553, 554, 555, 556, 557, 558, 559,
+    560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573, 574, 575,
+    576, 577, 578, 579, 580, 581, 582, 582, 650, 719, 719, 719, 719, 787, 787, 855,
+    855, 923, 923, 991, 991, 991, 991, 991, 991, 991, 1262, 683, 683, 683, 683, 683,
+    683, 683, 683, 683, 683, 683, 683, 683, 617, 617, 618, 619, 620, 621, 622, 623,
+    624, 625, 626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639,
+    640, 641, 642, 643, 644, 645, 646, 647, 648, 649, 650, 650, 719, 719, 719, 787,
+    787, 855, 855, 923, 923, 991, 991, 991, 991, 991, 991, 1194, 1262, 1262, 683, 683,
+    683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 683, 684, 685, 686, 687,
+    688, 689, 690, 691, 692, 693, 694, 695, 696, 697, 698, 699, 700, 701, 702, 703,
+    704, 705, 706, 707, 708, 709, 710, 711, 712, 713, 714, 715, 716, 717, 718, 719,
+    719, 787, 787, 855, 855, 923, 923, 991, 991, 991, 991, 991, 991, 1194, 1262, 1262,
+    1262, 750, 750, 750, 750, 750, 750, 750, 750, 750, 750, 750, 750, 750, 750, 751,
+    752, 753, 754, 755, 756, 757, 758, 759, 760, 761, 762, 763, 764, 765, 766, 767,
+    768, 769, 770, 771, 772, 773, 774, 775, 776, 777, 778, 779, 780, 781, 782, 783,
+    784, 785, 786, 787, 787, 855, 855, 923, 923, 991, 991, 991, 991, 991, 1194, 1194,
+    1262, 1262, 1262, 1262, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817, 817,
+    817, 817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831,
+    832, 833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847,
+    848, 849, 850, 851, 852, 853, 854, 855, 855, 923, 923, 991, 991, 991, 991, 991,
+    1194, 1194, 1262, 1262, 1262, 1262, 1262, 884, 884, 884, 884, 884, 884, 884, 884, 884,
+    884, 884, 884, 884, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895,
+    896, 897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911,
+    912, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 923, 991, 991, 991,
+    991, 1126, 1194, 1194, 1262, 1262, 1262, 1262, 1262, 1262, 951, 951, 951, 951, 951, 951,
+    951, 951, 951, 951, 951, 951, 951, 951, 952, 953, 954, 955, 956, 957, 958, 959,
+    960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975,
+    976, 977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991,
+    991, 991, 1126, 1126, 1194, 1194, 1262, 1262, 1262, 1262, 1262, 1262, 1465, 1018, 1018, 1018,
+    1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1018, 1019, 1020, 1021, 1022, 1023,
+    1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039,
+    1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
+    1056, 1057, 1058, 1058, 1126, 1126, 1194, 1194, 1262, 1262, 1262, 1262, 1262, 1465, 1465, 1465,
+    1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1085, 1086, 1087,
+    1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
+    1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118, 1119,
+    1120, 1121, 1122, 1123, 1124, 1125, 1126, 1126, 1194, 1194, 1262, 1262, 1262, 1262, 1262, 1465,
+    1465, 1465, 1465, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152, 1152,
+    1152, 1153, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167,
+    1168, 1169, 1170, 1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
+    1184, 1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194, 1194, 1262, 1262, 1262, 1262,
+    1397, 1465, 1465, 1465, 1465, 1465, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219, 1219,
+    1219, 1219, 1219, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231,
+    1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247,
+    1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1262,
+    1262, 1397, 1397, 1465, 1465, 1465, 1465, 1465, 1465, 1286, 1286, 1286, 1286, 1286, 1286, 1286,
+    1286, 1286, 1286, 1286, 1286, 1286, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
+    1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
+    1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327,
+    1328, 1329, 1329, 1397, 1397, 1465, 1465, 1465, 1465, 1465, 1600, 1600, 1353, 1353, 1353, 1353,
+    1353, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1353, 1354, 1355, 1356, 1357, 1358, 1359,
+    1360, 1361, 1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375,
+    1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
+    1392, 1393, 1394, 1395, 1396, 1397, 1397, 1465, 1465, 1465, 1465, 1600, 1600, 1600, 1600, 1420,
+    1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1420, 1421, 1422, 1423,
+    1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439,
+    1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455,
+    1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1465, 1465, 1600, 1600, 1600, 1600,
+    1600, 1735, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487, 1487,
+    1488, 1489, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503,
+    1504, 1505, 1506, 1507, 1508, 1509, 1510, 1511, 1512, 1513, 1514, 1515, 1516, 1517, 1518, 1519,
+    1520, 1521, 1522, 1523, 1524, 1525, 1526, 1527, 1528, 1529, 1530, 1531, 1532, 1532, 1600, 1600,
+    1600, 1600, 1735, 1735, 1735, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554, 1554,
+    1554, 1554, 1554, 1555, 1556, 1490, 1491, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1500,
+    1501, 1569, 1570, 1571, 1572, 1573, 1574, 1575, 1576, 1577, 1578, 1579, 1580, 1581, 1582, 1583,
+    1584, 1585, 1586, 1587, 1588, 1589, 1590, 1591, 1592, 1593, 1594, 1595, 1596, 1597, 1598, 1599,
+    1600, 1600, 1600, 1735, 1735, 1735, 1735, 1735, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1555, 1556, 1556, 1491, 1492, 1493, 1494, 1495, 1496, 1497,
+    1498, 1499, 1500, 1569, 1569, 1570, 1638, 1639, 1640, 1641, 1642, 1643, 1644, 1645, 1646, 1647,
+    1648, 1649, 1650, 1651, 1652, 1653, 1654, 1655, 1656, 1657, 1658, 1659, 1660, 1661, 1662, 1663,
+    1664, 1665, 1666, 1667, 1667, 1735, 1735, 1735, 1735, 1735, 1735, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1556, 1556, 1556, 1492, 1493, 1494,
+    1495, 1496, 1497, 1498, 1499, 1569, 1569, 1569, 1638, 1638, 1639, 1707, 1708, 1709, 1710, 1711,
+    1712, 1713, 1714, 1715, 1716, 1717, 1718, 1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727,
+    1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1735, 1735, 1735, 1735, 1735, 1937, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1556, 1556,
+    1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1569, 1569, 1638, 1638, 1638, 1707, 1707, 1708,
+    1776, 1777, 1778, 1779, 1780, 1781, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791,
+    1792, 1793, 1794, 1795, 1796, 1797, 1798, 1799, 1800, 1801, 1802, 1802, 1802, 1937, 1937, 1937,
+    1937, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1556, 1556, 1492, 1493, 1494, 1495, 1496, 1497, 1498, 1499, 1569, 1569, 1638, 1638, 1707,
+    1707, 1707, 1776, 1776, 1777, 1778, 1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855,
+    1856, 1857, 1858, 1859, 1860, 1861, 1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1869, 1937,
+    1937, 1937, 1937, 1937, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1556, 1556, 1493, 1494, 1495, 1496, 1497, 1498, 1569, 1569, 1638,
+    1638, 1638, 1707, 1707, 1776, 1776, 1776, 1777, 1846, 1846, 1847, 1915, 1916, 1917, 1918, 1919,
+    1920, 1921, 1922, 1923, 1924, 1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935,
+    1936, 1937, 1937, 1937, 1937, 1937, 1937, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1556, 1556, 1493, 1494, 1495, 1496, 1497, 1498,
+    1569, 1569, 1638, 1638, 1707, 1707, 1707, 1776, 1776, 1776, 1846, 1846, 1846, 1915, 1915, 1916,
+    1984, 1985, 1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999,
+    2000, 2001, 2002, 2003, 2004, 2004, 2004, 2139, 2139, 2139, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1556, 1493, 1494, 1495,
+    1496, 1497, 1498, 1569, 1638, 1638, 1638, 1707, 1707, 1776, 1776, 1776, 1776, 1846, 1846, 1915,
+    1915, 1915, 1984, 1984, 1985, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+    2064, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2071, 2139, 2139, 2139, 2139, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1556,
+    1556, 1494, 1495, 1496, 1497, 1569, 1569, 1638, 1638, 1707, 1707, 1707, 1776, 1776, 1776, 1776,
+    1846, 1846, 1915, 1915, 1984, 1984, 1984, 2053, 2053, 2121, 2122, 2123, 2124, 2125, 2126, 2127,
+    2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 2137, 2138, 2139, 2139, 2139, 2139, 2139,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1556, 1494, 1495, 1496, 1497, 1569, 1638, 1638, 1638, 1707, 1707, 1776, 1776,
+    1776, 1776, 1846, 1846, 1915, 1915, 1915, 1984, 1984, 2053, 2053, 2121, 2121, 2189, 2190, 2191,
+    2192, 2193, 2194, 2195, 2196, 2197, 2198, 2199, 2200, 2201, 2202, 2203, 2204, 2205, 2206, 2206,
+    2206, 2206, 2206, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1556, 1494, 1495, 1496, 1497, 1569, 1638, 1638, 1707, 1707,
+    1707, 1776, 1776, 1776, 1776, 1846, 1846, 1915, 1915, 1984, 1984, 1984, 2053, 2121, 2121, 2189,
+    2189, 2257, 2258, 2259, 2260, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 2270, 2271,
+    2272, 2273, 2273, 2273, 2408, 2408, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1494, 1495, 1496, 1497, 1638, 1638,
+    1638, 1707, 1707, 1776, 1776, 1776, 1776, 1776, 1846, 1915, 1915, 1915, 1984, 1984, 2053, 2121,
+    2121, 2189, 2189, 2257, 2257, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335,
+    2336, 2337, 2338, 2339, 2340, 2340, 2408, 2408, 2408, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1494, 1495, 1496,
+    1497, 1638, 1638, 1707, 1707, 1707, 1776, 1776, 1776, 1776, 1846, 1846, 1915, 1915, 1984, 1984,
+    1984, 2121, 2121, 2189, 2189, 2257, 2257, 2325, 2325, 2393, 2394, 2395, 2396, 2397, 2398, 2399,
+    2400, 2401, 2402, 2403, 2404, 2405, 2406, 2407, 2408, 2408, 2408, 2408, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1495, 1496, 1638, 1638, 1638, 1707, 1707, 1776, 1776, 1776, 1776, 1776, 1846, 1915, 1915,
+    1915, 1984, 1984, 2121, 2121, 2189, 2189, 2257, 2257, 2325, 2325, 2393, 2393, 2461, 2462, 2463,
+    2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473, 2474, 2475, 2475, 2475, 2475, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1495, 1496, 1638, 1638, 1707, 1707, 1707, 1776, 1776, 1776, 1776, 1776,
+    1846, 1915, 1915, 1984, 1984, 2121, 2121, 2189, 2189, 2257, 2257, 2325, 2325, 2393, 2393, 2461,
+    2461, 2529, 2530, 2531, 2532, 2533, 2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2542,
+    2542, 2542, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1495, 1496, 1638, 1638, 1707, 1707, 1776, 1776, 1776,
+    1776, 1776, 1846, 1915, 1915, 1915, 1984, 1984, 2121, 2189, 2189, 2257, 2257, 2325, 2325, 2393,
+    2393, 2461, 2461, 2529, 2529, 2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607,
+    2608, 2609, 2609, 2609, 2609, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1495, 1496, 1638, 1707, 1707, 1707,
+    1776, 1776, 1776, 1776, 1776, 1846, 1915, 1915, 1984, 1984, 2121, 2189, 2189, 2257, 2257, 2325,
+    2325, 2393, 2393, 2461, 2461, 2529, 2664, 2664, 2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671,
+    2672, 2673, 2674, 2675, 2676, 2676, 2676, 2676, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1638, 1638,
+    1707, 1707, 1776, 1776, 1776, 1776, 1776, 1776, 1915, 1915, 1915, 1984, 2121, 2189, 2189, 2257,
+    2257, 2325, 2325, 2393, 2393, 2461, 2461, 2664, 2664, 2664, 2664, 2664, 2732, 2733, 2734, 2735,
+    2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2743, 2743, 2743, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1638, 1707, 1707, 1707, 1776, 1776, 1776, 1776, 1776, 1846, 1915, 1915, 1984, 1984, 2189,
+    2189, 2257, 2257, 2325, 2325, 2393, 2393, 2461, 2664, 2664, 2664, 2664, 2664, 2664, 2732, 2732,
+    2800, 2801, 2802, 2803, 2804, 2805, 2806, 2807, 2808, 2809, 2810, 2810, 2810, 2810, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1638, 1707, 1707, 1776, 1776, 1776, 1776, 1776, 1776, 1915, 1915, 1915,
+    1984, 2189, 2189, 2257, 2257, 2325, 2325, 2393, 2393, 2461, 2664, 2664, 2664, 2664, 2664, 2664,
+    2732, 2867, 2867, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874, 2875, 2876, 2877, 2877, 2877,
+    2877, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1707, 1707, 1707, 1776, 1776, 1776, 1776, 1776, 1776,
+    1915, 1915, 1984, 2189, 2189, 2257, 2257, 2325, 2325, 2393, 2393, 2664, 2664, 2664, 2664, 2664,
+    2664, 2664, 2934, 2934, 2934, 2934, 2934, 2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943,
+    2944, 2944, 2944, 2944, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1707, 1707, 1776, 1776, 1776, 1776,
+    1776, 1776, 1915, 1915, 1915, 2189, 2189, 2257, 2257, 2325, 2325, 2393, 2393, 2664, 2664, 2664,
+    2664, 2664, 2664, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 3002, 3003, 3004, 3005, 3006, 3007,
+    3008, 3009, 3010, 3011, 3011, 3011, 3011, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1707, 1707, 1776,
+    1776, 1776, 1776, 1776, 1776, 1915, 1915, 1984, 2189, 2257, 2257, 2325, 2325, 2393, 2664, 2664,
+    2664, 2664, 2664, 2664, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 3069, 3069, 3069, 3070, 3071,
+    3072, 3073, 3074, 3075, 3076, 3077, 3078, 3078, 3078, 3078, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1707, 1776, 1776, 1776, 1776, 1776, 1776, 1915, 1915, 1915, 2189, 2257, 2257, 2325, 2325, 2393,
+    2664, 2664, 2664, 2664, 2664, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 3069, 3069, 3069, 3069,
+    3069, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144, 3145, 3145, 3145, 3145, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1707, 1776, 1776, 1776, 1776, 1776, 1776, 1915, 1915, 2189, 2257, 2257, 2325,
+    2325, 2393, 2664, 2664, 2664, 2664, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 3069, 3069, 3069,
+    3069, 3069, 3204, 3204, 3204, 3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3212, 3212, 3212,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1776, 1776, 1776, 1776, 1776, 1776, 1776, 1915, 1915, 2257,
+    2257, 2325, 2325, 2664, 2664, 2664, 2664, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 3069, 3069,
+    3069, 3069, 3069, 3271, 3271, 3271, 3271, 3271, 3272, 3273, 3274, 3275, 3276, 3277, 3278, 3279,
+    3279, 3279, 3279, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1776, 1776, 1776, 1776, 1776, 1776, 1915,
+    1915, 2257, 2257, 2325, 2325, 2664, 2664, 2664, 2934, 2934, 2934, 2934, 2934, 2934, 2934, 3069,
+    3069, 3069, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3338, 3339, 3340, 3341, 3342, 3343,
+    3344, 3345, 3279, 3279, 3279, 3279, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1776, 1776, 1776, 1776,
+    1776, 1776, 1915, 2257, 2257, 2325, 2325, 2664, 2664, 2934, 2934, 2934, 2934, 2934, 2934, 2934,
+    3069, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3406, 3407,
+    3408, 3409, 3410, 3411, 3412, 3412, 3412, 3279, 3279, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1776,
+    1776, 1776, 1776, 1776, 1915, 2257, 2257, 2325, 2664, 2664, 2934, 2934, 2934, 2934, 2934, 2934,
+    3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405,
+    3405, 3473, 3474, 3475, 3476, 3477, 3478, 3479, 3479, 3479, 3479, 3479, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1776, 1776, 1776, 1776, 1776, 1776, 1915, 2257, 2325, 2664, 2934, 2934, 2934, 2934, 3405,
+    3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405,
+    3405, 3405, 3540, 3540, 3540, 3541, 3542, 3543, 3544, 3545, 3546, 3546, 3546, 3546, 3546, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1776, 1776, 1776, 1776, 1776, 1776, 2257, 2325, 2934, 2934, 2934, 3405,
+    3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405,
+    3405, 3405, 3405, 3607, 3607, 3607, 3607, 3607, 3608, 3609, 3610, 3611, 3612, 3546, 3546, 3546,
+    3546, 3546, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1776, 1776, 1776, 1776, 1776, 2257, 2934, 3405, 3405,
+    3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405,
+    3405, 3405, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3674, 3675, 3676, 3677, 3678, 3679,
+    3679, 3679, 3546, 3546, 3546, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1776, 1776, 1776, 1776, 1776, 3405,
+    3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405, 3405,
+    3405, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3741, 3742, 3743,
+    3744, 3745, 3746, 3746, 3746, 3746, 3746, 3546, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1776, 1776, 1776,
+    4742, 4409, 4409, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142,
+    4142, 4142, 4142, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808, 3808,
+    3808, 3809, 3810, 3811, 3812, 3746, 3746, 3746, 3746, 3746, 3746, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1776, 4742, 4742, 4742, 4742, 4742, 4409, 4409, 4409, 4409, 4142, 4142, 4142, 4142, 4142, 4142,
+    4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 3875, 3875, 3875, 3875, 3875,
+    3875, 3875, 3875, 3875, 3876, 3877, 3878, 3879, 3879, 3879, 3746, 3746, 3746, 3746, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4409, 4409, 4409, 4409,
+    4409, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142,
+    4142, 3942, 3942, 3942, 3942, 3942, 3942, 3943, 3944, 3945, 3946, 3946, 3946, 3946, 3946, 3746,
+    3746, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4409, 4409, 4409, 4409, 4409, 4409, 4409, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142,
+    4142, 4142, 4142, 4142, 4142, 4142, 4142, 4009, 4009, 4009, 4010, 4011, 4012, 3946, 3946, 3946,
+    3946, 3946, 3946, 3946, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4409, 4409, 4409, 4409, 4409, 4409, 4409, 4409, 4142,
+    4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4076, 4076, 4077, 4078, 4079,
+    4079, 4079, 3946, 3946, 3946, 3946, 3946, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4409, 4409, 4409, 4409,
+    4409, 4409, 4409, 4409, 4409, 4409, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4142, 4143,
+    4144, 4145, 4079, 4079, 4079, 4079, 4079, 3946, 3946, 3946, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4609, 4409, 4409, 4409, 4409, 4409, 4409, 4409, 4409, 4409, 4409, 4209, 4209, 4209, 4209,
+    4209, 4209, 4210, 4211, 4212, 4212, 4212, 4079, 4079, 4079, 4079, 4079, 3946, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4609, 4609, 4409, 4409, 4409, 4409, 4409, 4409, 4409, 4409,
+    4409, 4409, 4276, 4276, 4276, 4277, 4278, 4212, 4212, 4212, 4212, 4212, 4079, 4079, 4079, 4079,
+    1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4609, 4609, 4609, 4409, 4409,
+    4409, 4409, 4409, 4409, 4409, 4409, 4343, 4343, 4344, 4278, 4278, 4212, 4212, 4212, 4212, 4212,
+    4212, 4079, 4079, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4609, 4609, 4609, 4609, 4409, 4409, 4409, 4409, 4409, 4409, 4410, 4411, 4411, 4411, 4278, 4212,
+    4212, 4212, 4212, 4212, 4212, 4212, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4609, 4609, 4609, 4609, 4609, 4476, 4476, 4476, 4477, 4411, 4411,
+    4411, 4411, 4411, 4212, 4212, 4212, 4212, 4212, 4212, 1621, 1621, 1621, 1621, 1621, 1621, 1621,
+    1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4609, 4609, 4609, 4609, 4543, 4543,
+    4477, 4477, 4411, 4411, 4411, 4411, 4411, 4411, 4212, 4212, 4212, 4212, 1621, 1621, 1621, 1621,
+    1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4609,
+    4609, 4609, 4543, 4543, 4477, 4477, 4411, 4411, 4411, 4411, 4411, 4411, 4212, 4212, 4212, 1621,
+    1621, 1621, 1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4676, 4676, 4676, 4676, 4543, 4477, 4477, 4411, 4411, 4411, 4411, 4411, 4411,
+    4411, 4212, 1621, 1621, 1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4676, 4676, 4676, 4676, 4676, 4477, 4477, 4411, 4411,
+    4411, 4411, 4411, 4411, 4411, 1621, 1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4676, 4676, 4676, 4676, 4676,
+    4676, 4477, 4411, 4411, 4411, 4411, 4411, 4411, 1621, 1621, 1621, 1621, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4676,
+    4676, 4676, 4676, 4676, 4676, 4477, 4411, 4411, 4411, 4411, 4411, 1621, 1621, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4676, 4676, 4676, 4676, 4676, 4676, 4676, 4411, 4411, 4411, 4411, 1621, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4676, 4676, 4676, 4676, 4676, 4676, 4676, 4411, 4411,
+    4411, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4676, 4676, 4676, 4676, 4676,
+    4676, 4676, 4676, 4411, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4676,
+    4676, 4676, 4676, 4676, 4676, 4676, 4676, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4676, 4676, 4676, 4676, 4676, 4676, 4676, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742, 4742,
+    4742, 4742, 4742, 4742, 4742, 4742, 4742, 4676, 4676, 4676, 4676, 4676, 4676,
+};
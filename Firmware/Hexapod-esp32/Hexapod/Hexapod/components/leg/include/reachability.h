@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+// Leg workspace check against the joint limits of pathTool/src/config.py
+// (angleLimitation), in leg local coordinates (mm).
+//
+// The femur/tibia plane is covered by a precomputed grid (reach_grid.h,
+// generated by pathTool/src/reach.py): cells fully inside or outside the
+// workspace answer in O(1), only cells on its edge run the IK to decide.
+// The hip yaw limit is checked directly on the target.
+
+namespace hexapod {
+
+    namespace reachability {
+
+        bool reachable(float x, float y, float z);
+
+        // Move an unreachable point onto the nearest grid cell inside the
+        // workspace (hip yaw clamped to its limit). Returns false and leaves
+        // the point alone if it is already reachable.
+        bool clamp(float& x, float& y, float& z);
+
+        // Symmetric servo range (degree) that covers joint `joint`'s limits
+        float jointRange(int joint);
+
+        // Points clamp() had to move since boot
+        uint32_t clampCount();
+    }
+}
@@ -1,102 +1,24 @@
 #include "leg.h"
 #include "config.h"
 #include "debug.h"
+#include "event_log.h"
 #include "base.h"
+#include "fast_math.h"
+#include "kinematics.h"
+#include "reachability.h"
 
 #include <cmath>
 
 using namespace hexapod::config;
 
-// Angle (CCW)
-//          0 : + X-axis
-//         90 : + Y-axis
-//        180 : - X-axis
-//        270 : - Y-axis
-
 namespace hexapod {
 
-    namespace {
-
-        // rotate matrix:
-        //  x' = x * cos - y * sin
-        //  y' = x * sin + y * cos
-
-        #define SIN45   0.7071
-        #define COS45   0.7071
-
-        void rotate0(const Point3D& src, Point3D& dest) {
-            dest = src;
-        }
-
-        void rotate45(const Point3D& src, Point3D& dest) {
-            dest.x_ = src.x_ * COS45 - src.y_ * SIN45;
-            dest.y_ = src.x_ * SIN45 + src.y_ * COS45;
-            dest.z_ = src.z_;
-        }
-
-        void rotate135(const Point3D& src, Point3D& dest) {
-            dest.x_ = src.x_ * (-COS45) - src.y_ * SIN45;
-            dest.y_ = src.x_ * SIN45 + src.y_ * (-COS45);
-            dest.z_ = src.z_;
-        }
-
-        void rotate180(const Point3D& src, Point3D& dest) {
-            dest.x_ = -src.x_;
-            dest.y_ = -src.y_;
-            dest.z_ = src.z_;
-        }
-
-        void rotate225(const Point3D& src, Point3D& dest) {
-            dest.x_ = src.x_ * (-COS45) - src.y_ * (-SIN45);
-            dest.y_ = src.x_ * (-SIN45) + src.y_ * (-COS45);
-            dest.z_ = src.z_;
-        }
-
-        void rotate315(const Point3D& src, Point3D& dest) {
-            dest.x_ = src.x_ * COS45 - src.y_ * (-SIN45);
-            dest.y_ = src.x_ * (-SIN45) + src.y_ * COS45;
-            dest.z_ = src.z_;
-        }
-    }
-
     // Public
 
-    Leg::Leg(int legIndex): index_(legIndex) {
-        switch(legIndex) {
-        case 0: // 45 degree
-            mountPosition_ = Point3D(kLegMountOtherX, kLegMountOtherY, 0);
-            localConv_ = rotate315;
-            worldConv_ = rotate45;
-            break;
-        case 1: // 0 degree
-            mountPosition_ = Point3D(kLegMountLeftRightX, 0, 0);
-            localConv_ = rotate0;
-            worldConv_ = rotate0;
-            break;
-        case 2: // -45 or 315 degree
-            mountPosition_ = Point3D(kLegMountOtherX, -kLegMountOtherY, 0);
-            localConv_ = rotate45;
-            worldConv_ = rotate315;
-            break;
-        case 3: // -135 or 225 degree
-            mountPosition_ = Point3D(-kLegMountOtherX, -kLegMountOtherY, 0);
-            localConv_ = rotate135;
-            worldConv_ = rotate225;
-            break;
-        case 4: // 180 degree
-            mountPosition_ = Point3D(-kLegMountLeftRightX, 0, 0);
-            localConv_ = rotate180;
-            worldConv_ = rotate180;
-            break;
-        case 5: // 135 degree
-            mountPosition_ = Point3D(-kLegMountOtherX, kLegMountOtherY, 0);
-            localConv_ = rotate225;
-            worldConv_ = rotate135;
-            break;
-        }
-
+    Leg::Leg(int legIndex): index_(legIndex), mount_(geometry::kLegMounts[legIndex]) {
+        // servo clipping matches the workspace reachability::clamp() keeps IK in
         for(int i=0;i<3;i++)
-            servos_[i] = new hexapod::Servo(legIndex, i);
+            servos_[i] = new hexapod::Servo(legIndex, i, 0.0f, false, reachability::jointRange(i));
     }
 
     Leg::~Leg() {
@@ -106,15 +28,6 @@ namespace hexapod {
         }
     }
 
-    void Leg::translateToLocal(const Point3D& world, Point3D& local) {
-        localConv_(world - mountPosition_, local);
-    }
-
-    void Leg::translateToWorld(const Point3D& local, Point3D& world) {
-        worldConv_(local, world);
-        world += mountPosition_;
-    }
-
     void Leg::setJointAngle(float angle[3]) {
         Point3D to;
         _forwardKinematics(angle, to);
@@ -127,12 +40,23 @@ namespace hexapod {
 
         Point3D local;
         translateToLocal(to, local);
-        LOG_DEBUG("leg(%d) moveTip(%f,%f,%f)(%f,%f,%f)", index_, to.x_, to.y_, to.z_, local.x_, local.y_, local.z_);
+        EVENT_LOG(LEG_MOVE_TIP, index_, to.x_, to.y_, to.z_, local.x_, local.y_, local.z_);
         _move(local);
         tipPos_ = to;
         tipPosLocal_ = local;
     }
 
+    void Leg::moveTipSolved(const Point3D& to, const float angles[3]) {
+        if (to == tipPos_)
+            return;
+
+        for(int i=0; i<3; i++) {
+            servos_[i]->setAngle(angles[i]);
+        }
+        tipPos_ = to;
+        translateToLocal(to, tipPosLocal_);
+    }
+
     const Point3D& Leg::getTipPosition(void) {
         return tipPos_;
     }
@@ -155,8 +79,8 @@ namespace hexapod {
     //
     // Private
     //
-    const float pi = std::acos(-1);
-    const float hpi = pi/2;
+    constexpr float pi = fastmath::kPi;
+    constexpr float hpi = pi/2;
 
     void Leg::_forwardKinematics(float angle[3], Point3D& out) {
         float radian[3];
@@ -171,27 +95,24 @@ namespace hexapod {
     }
 
     void Leg::_inverseKinematics(const Point3D& to, float angles[3]) {
+        kinematics::inverse(to.x_, to.y_, to.z_, angles[0], angles[1], angles[2]);
+    }
 
-        float x = to.x_ - kLegRootToJoint1;
-        float y = to.y_;
-
-        angles[0] = std::atan2(y, x) * 180 / pi;
+    void Leg::_inverseKinematicsLibm(const Point3D& to, float angles[3]) {
+        kinematics::inverseLibm(to.x_, to.y_, to.z_, angles[0], angles[1], angles[2]);
+    }
 
-        x = std::sqrt(x*x + y*y) - kLegJoint1ToJoint2;
-        y = to.z_;
-        float ar = std::atan2(y, x);
-        float lr2 = x*x + y*y;
-        float lr = std::sqrt(lr2);
-        float a1 = std::acos((lr2 + kLegJoint2ToJoint3*kLegJoint2ToJoint3 - kLegJoint3ToTip*kLegJoint3ToTip)/(2*kLegJoint2ToJoint3*lr));
-        float a2 = std::acos((lr2 - kLegJoint2ToJoint3*kLegJoint2ToJoint3 + kLegJoint3ToTip*kLegJoint3ToTip)/(2*kLegJoint3ToTip*lr));
-        angles[1] = (ar + a1) * 180 / pi;
-        angles[2] = 90 - ((a1 + a2)  * 180 / pi);
+    void Leg::_inverseKinematicsFast(const Point3D& to, float angles[3]) {
+        kinematics::inverseFast(to.x_, to.y_, to.z_, angles[0], angles[1], angles[2]);
     }
 
     void Leg::_move(const Point3D& to) {
+        Point3D target = to;
+        reachability::clamp(target.x_, target.y_, target.z_);
+
         float angles[3];
-        _inverseKinematics(to, angles);
-        LOG_DEBUG("leg(%d) move: (%f,%f,%f)", index_, angles[0], angles[1], angles[2]);
+        _inverseKinematics(target, angles);
+        EVENT_LOG(LEG_MOVE, index_, angles[0], angles[1], angles[2]);
         for(int i=0; i<3; i++) {
             servos_[i]->setAngle(angles[i]);
         }
@@ -0,0 +1,128 @@
+#include "reachability.h"
+#include "config.h"
+#include "fast_math.h"
+#include "kinematics.h"
+
+#include <cmath>
+
+using namespace hexapod::config;
+
+namespace hexapod {
+
+    namespace reachability {
+
+#include "reach_grid.h"
+
+        namespace {
+
+            enum CellState {
+                CELL_OUTSIDE = 0,
+                CELL_INSIDE = 1,
+                CELL_BOUNDARY = 2,
+            };
+
+            uint32_t clamped = 0;
+
+            constexpr float kInvCell = 1.0f / kReachCell;
+
+            int cellIndex(float r, float z) {
+                float c = (r - kReachOriginR) * kInvCell;
+                float w = (z - kReachOriginZ) * kInvCell;
+                // also rejects NaN
+                if (!(c >= 0 && c < kReachCols && w >= 0 && w < kReachRows))
+                    return -1;
+                return (int)w * kReachCols + (int)c;
+            }
+
+            int cellIndexClamped(float r, float z) {
+                int col = (int)std::floor((r - kReachOriginR) * kInvCell);
+                int row = (int)std::floor((z - kReachOriginZ) * kInvCell);
+                col = col < 0 ? 0 : (col >= kReachCols ? kReachCols - 1 : col);
+                row = row < 0 ? 0 : (row >= kReachRows ? kReachRows - 1 : row);
+                return row * kReachCols + col;
+            }
+
+            CellState cellState(int index) {
+                return (CellState)((kReachState[index >> 2] >> ((index & 3) * 2)) & 3);
+            }
+
+            bool withinLimits(float angle, int joint) {
+                return angle >= kJointLimits[joint][0] && angle <= kJointLimits[joint][1];
+            }
+
+            // r: horizontal distance from the femur axis, z: tip height
+            bool planeReachable(float r, float z) {
+                int index = cellIndex(r, z);
+                if (index < 0)
+                    return false;
+
+                switch (cellState(index)) {
+                case CELL_INSIDE:
+                    return true;
+                case CELL_BOUNDARY: {
+                    float a0, a1, a2;
+                    kinematics::inverse(kLegRootToJoint1 + kLegJoint1ToJoint2 + r, 0, z, a0, a1, a2);
+                    // NaN fails both comparisons
+                    return withinLimits(a1, 1) && withinLimits(a2, 2);
+                }
+                default:
+                    return false;
+                }
+            }
+
+            // |yaw| <= limit (< 90 degree) without atan2
+            bool yawReachable(float dx, float dy) {
+                return dx > 0 && std::fabs(dy) <= dx * kReachYawTan;
+            }
+        }
+
+        bool reachable(float x, float y, float z) {
+            float dx = x - kLegRootToJoint1;
+            if (!yawReachable(dx, y))
+                return false;
+            return planeReachable(std::sqrt(dx*dx + y*y) - kLegJoint1ToJoint2, z);
+        }
+
+        bool clamp(float& x, float& y, float& z) {
+            float dx = x - kLegRootToJoint1;
+            float h = std::sqrt(dx*dx + y*y);
+            float r = h - kLegJoint1ToJoint2;
+
+            bool yawOk = yawReachable(dx, y);
+            bool planeOk = planeReachable(r, z);
+            if (yawOk && planeOk)
+                return false;
+
+            float c = h > 0 ? dx / h : 1;
+            float s = h > 0 ? y / h : 0;
+            if (!yawOk) {
+                // a hair inside the limit so the result passes yawReachable()
+                float limit = kJointLimits[0][1] * fastmath::kDegToRad - 1e-4f;
+                float yaw = std::atan2(y, dx);
+                yaw = yaw > limit ? limit : (yaw < -limit ? -limit : yaw);
+                c = std::cos(yaw);
+                s = std::sin(yaw);
+            }
+            if (!planeOk) {
+                int nearest = kReachNearest[cellIndexClamped(r, z)];
+                r = kReachOriginR + (nearest % kReachCols + 0.5f) * kReachCell;
+                z = kReachOriginZ + (nearest / kReachCols + 0.5f) * kReachCell;
+            }
+
+            h = r + kLegJoint1ToJoint2;
+            x = kLegRootToJoint1 + h * c;
+            y = h * s;
+            clamped++;
+            return true;
+        }
+
+        float jointRange(int joint) {
+            float lo = std::fabs(kJointLimits[joint][0]), hi = std::fabs(kJointLimits[joint][1]);
+            return lo > hi ? lo : hi;
+        }
+
+        uint32_t clampCount() {
+            return clamped;
+        }
+    }
+}
@@ -0,0 +1,30 @@
+#include <atomic>
+#include "hexapod_metrics.h"
+#include "metrics.h"
+
+using namespace hexapod;
+
+namespace {
+
+std::atomic<hexapod_metrics_counters_t> counters{nullptr};
+
+} // namespace
+
+void hexapod_metrics_set_counters(hexapod_metrics_counters_t format) {
+    counters.store(format, std::memory_order_release);
+}
+
+size_t hexapod_metrics_format(int index, char *out, size_t size) {
+    if (!size || index < 0)
+        return 0;
+    if (index < metrics::METRIC_TOTAL)
+        return metrics::format((metrics::Metric)index, out, size);
+    hexapod_metrics_counters_t format = counters.load(std::memory_order_acquire);
+    if (index == metrics::METRIC_TOTAL && format)
+        return format(out, size);
+    return 0;
+}
+
+void hexapod_metrics_reset(void) {
+    metrics::reset();
+}
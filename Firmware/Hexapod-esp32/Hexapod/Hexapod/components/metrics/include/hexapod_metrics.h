@@ -0,0 +1,43 @@
+#pragma once
+
+// /metrics of the web server: the latency histograms of metrics.h and the
+// counters the motion stack registers, as Prometheus text.
+//
+//     char buf[2048];
+//     size_t len;
+//     for (int i = 0; (len = hexapod_metrics_format(i, buf, sizeof(buf))); i++)
+//         send(buf, len);
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Prometheus text of the counters into out, truncated to size.
+ * Returns the length.
+ */
+typedef size_t (*hexapod_metrics_counters_t)(char *out, size_t size);
+
+/**
+ * @brief Serve `format` as the last block, NULL for none. Set once at start,
+ * before the web server runs.
+ */
+void hexapod_metrics_set_counters(hexapod_metrics_counters_t format);
+
+/**
+ * @brief Prometheus text of block `index` (one histogram, or the counters)
+ * into out, truncated to size. Returns the length, 0 past the last block.
+ */
+size_t hexapod_metrics_format(int index, char *out, size_t size);
+
+/**
+ * @brief Empty the histograms, to measure a change from a clean start.
+ * The counters keep counting.
+ */
+void hexapod_metrics_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Latency histograms of the motion loop, served as Prometheus text by the
+// web server's /metrics route.
+//
+//   X(id, name, help)
+//
+// All histograms share the fixed buckets of kBoundsUs. Each one has a single
+// writer task, record() is a handful of relaxed atomic adds and never blocks.
+
+#define HEXAPOD_METRICS(X) \
+    X(FRAME_JITTER,  "hexapod_frame_jitter_us",  "Motion task wake-up after its deadline") \
+    X(FRAME_NEXT,    "hexapod_frame_next_us",    "Movement::next") \
+    X(FRAME_POSE,    "hexapod_frame_pose_us",    "Body pose transform of the tip locations") \
+    X(FRAME_IK,      "hexapod_frame_ik_us",      "Joint solve, 0 on a keyframe with table joints") \
+    X(FRAME_STAGE,   "hexapod_frame_stage_us",   "Leg transforms and servo staging") \
+    X(FRAME_COMMIT,  "hexapod_frame_commit_us",  "Servo::commit, the hand-over to the servo output task") \
+    X(FRAME_LATENCY, "hexapod_frame_latency_us", "Deadline to servo frame committed") \
+    X(SERVO_WRITE,   "hexapod_servo_write_us",   "Servo frame committed to on the wire (I2C)")
+
+namespace hexapod {
+namespace metrics {
+
+enum Metric : uint8_t {
+#define X(id, name, help) id,
+    HEXAPOD_METRICS(X)
+#undef X
+    METRIC_TOTAL
+};
+
+// upper bounds of the buckets, a last +Inf bucket follows
+constexpr uint32_t kBoundsUs[] = {5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000, 10000, 20000};
+constexpr int kBuckets = sizeof(kBoundsUs) / sizeof(kBoundsUs[0]) + 1;
+
+struct Snapshot {
+    uint32_t buckets[kBuckets];     /*!< samples per bucket, not cumulative */
+    uint32_t count;                 /*!< sum of buckets */
+    uint64_t sumUs;
+};
+
+/** @brief Add one sample, from the metric's writer task only */
+void record(Metric id, uint32_t us);
+
+/**
+ * @brief Empty every histogram, from any task. Each writer clears its own on
+ * its next record(), until then it reads as empty.
+ */
+void reset();
+
+Snapshot snapshot(Metric id);
+
+/**
+ * @brief Upper bound of the bucket holding quantile q (0..1) of the samples,
+ * UINT32_MAX when it is the +Inf bucket, 0 when there are none.
+ */
+uint32_t quantile(const Snapshot& s, float q);
+
+/**
+ * @brief Prometheus text of one histogram (HELP, TYPE, cumulative buckets,
+ * sum, count) into out, truncated to size. Returns the length.
+ */
+size_t format(Metric id, char* out, size_t size);
+
+} // namespace metrics
+} // namespace hexapod
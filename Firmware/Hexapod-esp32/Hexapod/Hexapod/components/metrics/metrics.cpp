@@ -0,0 +1,109 @@
+#include <atomic>
+#include <stdio.h>
+#include "metrics.h"
+
+namespace hexapod {
+namespace metrics {
+
+namespace {
+
+struct Info {
+    const char* name;
+    const char* help;
+};
+
+constexpr Info kMetrics[] = {
+#define X(id, name, help) {name, help},
+    HEXAPOD_METRICS(X)
+#undef X
+};
+
+struct Histogram {
+    std::atomic<uint32_t> buckets[kBuckets];
+    std::atomic<uint64_t> sumUs;
+    std::atomic<uint32_t> generation;   // reset() the contents belong to
+};
+
+Histogram histograms[METRIC_TOTAL];
+std::atomic<uint32_t> generation{0};
+
+int bucketOf(uint32_t us) {
+    int i = 0;
+    while (i < kBuckets - 1 && us > kBoundsUs[i])
+        i++;
+    return i;
+}
+
+} // namespace
+
+void record(Metric id, uint32_t us) {
+    Histogram& h = histograms[id];
+    uint32_t gen = generation.load(std::memory_order_acquire);
+    if (h.generation.load(std::memory_order_relaxed) != gen) {
+        for (auto& b : h.buckets)
+            b.store(0, std::memory_order_relaxed);
+        h.sumUs.store(0, std::memory_order_relaxed);
+        h.generation.store(gen, std::memory_order_release);
+    }
+    h.buckets[bucketOf(us)].fetch_add(1, std::memory_order_relaxed);
+    h.sumUs.fetch_add(us, std::memory_order_relaxed);
+}
+
+void reset() {
+    generation.fetch_add(1, std::memory_order_release);
+}
+
+Snapshot snapshot(Metric id) {
+    Snapshot s = {};
+    const Histogram& h = histograms[id];
+    if (h.generation.load(std::memory_order_acquire) != generation.load(std::memory_order_acquire))
+        return s;   // reset, not cleared by the writer yet
+
+    for (int i = 0; i < kBuckets; i++) {
+        s.buckets[i] = h.buckets[i].load(std::memory_order_relaxed);
+        s.count += s.buckets[i];
+    }
+    s.sumUs = h.sumUs.load(std::memory_order_relaxed);
+    return s;
+}
+
+uint32_t quantile(const Snapshot& s, float q) {
+    if (!s.count)
+        return 0;
+
+    uint32_t rank = (uint32_t)(q * (float)(s.count - 1)) + 1;
+    uint32_t seen = 0;
+    for (int i = 0; i < kBuckets - 1; i++) {
+        seen += s.buckets[i];
+        if (seen >= rank)
+            return kBoundsUs[i];
+    }
+    return UINT32_MAX;
+}
+
+size_t format(Metric id, char* out, size_t size) {
+    if (!size)
+        return 0;
+
+    const Info& info = kMetrics[id];
+    Snapshot s = snapshot(id);
+    size_t len = 0;
+    auto append = [&](int n) {
+        if (n > 0) len += (size_t)n;
+        if (len >= size) len = size - 1;
+    };
+
+    append(snprintf(out + len, size - len, "# HELP %s %s\n# TYPE %s histogram\n", info.name, info.help, info.name));
+    uint32_t cumulative = 0;
+    for (int i = 0; i < kBuckets - 1; i++) {
+        cumulative += s.buckets[i];
+        append(snprintf(out + len, size - len, "%s_bucket{le=\"%lu\"} %lu\n",
+            info.name, (unsigned long)kBoundsUs[i], (unsigned long)cumulative));
+    }
+    append(snprintf(out + len, size - len, "%s_bucket{le=\"+Inf\"} %lu\n%s_sum %llu\n%s_count %lu\n",
+        info.name, (unsigned long)s.count, info.name, (unsigned long long)s.sumUs, info.name, (unsigned long)s.count));
+    return len;
+}
+
+} // namespace metrics
+} // namespace hexapod
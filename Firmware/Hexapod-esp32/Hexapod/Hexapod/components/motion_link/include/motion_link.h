@@ -0,0 +1,121 @@
+#pragma once
+
+// Framed binary link between the ESP32 (commands) and the STM32 motion
+// controller (telemetry). The codec is plain C shared by both firmwares and
+// the host bench; motion_link_uart.c is the ESP32 endpoint, the STM32 one
+// lives in its Core/Src/link_uart.c.
+//
+//     0xA5 | len | seq | type | payload[len] | crc16 (little endian)
+//
+// crc16 is CRC-16/CCITT-FALSE over len, seq, type and the payload. Each side
+// numbers its own frames; the receiver counts seq gaps as lost frames.
+// Commands are latest-wins and never retransmitted, the telemetry carries the
+// seq of the last command applied instead.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MOTION_LINK_SYNC            0xA5
+#define MOTION_LINK_MAX_PAYLOAD     48
+#define MOTION_LINK_OVERHEAD        6       /*!< sync, len, seq, type, crc16 */
+#define MOTION_LINK_MAX_FRAME       (MOTION_LINK_MAX_PAYLOAD + MOTION_LINK_OVERHEAD)
+#define MOTION_LINK_BAUD            921600
+
+typedef enum {
+    MOTION_LINK_PING        = 0x01,     /*!< any payload, answered by a PONG echoing it */
+    MOTION_LINK_PONG        = 0x02,
+    MOTION_LINK_MODE        = 0x10,     /*!< motion_link_mode_t, ESP32 -> STM32 */
+    MOTION_LINK_SPEED       = 0x11,     /*!< motion_link_speed_t */
+    MOTION_LINK_POSE        = 0x12,     /*!< motion_link_pose_t */
+    MOTION_LINK_FRAME       = 0x13,     /*!< motion_link_frame_t, joint angles bypassing the gait */
+    MOTION_LINK_TELEMETRY   = 0x20,     /*!< motion_link_telemetry_t, STM32 -> ESP32 every tick */
+} motion_link_type_t;
+
+// Payloads, little endian on every end of the link
+
+typedef struct __attribute__((packed)) {
+    uint8_t mode;           /*!< MovementMode, leaves a FRAME override */
+} motion_link_mode_t;
+
+typedef struct __attribute__((packed)) {
+    float speed;            /*!< config::minSpeed .. config::maxSpeed */
+} motion_link_speed_t;
+
+typedef struct __attribute__((packed)) {
+    float roll, pitch, yaw; /*!< degrees */
+    float x, y, z;          /*!< mm */
+} motion_link_pose_t;
+
+typedef struct __attribute__((packed)) {
+    int16_t angle[18];      /*!< leg * 3 + joint, 0.01 degree */
+} motion_link_frame_t;
+
+typedef struct __attribute__((packed)) {
+    uint32_t ticks;         /*!< control ticks run */
+    uint32_t overruns;      /*!< ticks that missed their period */
+    uint32_t max_cycles;    /*!< slowest tick in CPU cycles */
+    uint8_t mode;
+    uint8_t ack_seq;        /*!< seq of the last command applied */
+    uint16_t rx_errors;     /*!< frames the STM32 dropped (CRC, length) */
+    uint16_t rx_lost;       /*!< seq gaps seen by the STM32 */
+} motion_link_telemetry_t;
+
+typedef struct {
+    uint32_t frames;        /*!< frames delivered */
+    uint32_t crc_errors;
+    uint32_t len_errors;    /*!< length over MOTION_LINK_MAX_PAYLOAD */
+    uint32_t skipped;       /*!< bytes discarded while looking for the sync byte */
+    uint32_t lost;          /*!< seq gaps: frames of the peer that never decoded */
+} motion_link_stats_t;
+
+typedef struct {
+    uint8_t type;
+    uint8_t seq;
+    uint8_t len;
+    const uint8_t *payload; /*!< valid during the handler call only */
+} motion_link_msg_t;
+
+typedef void (*motion_link_handler_t)(const motion_link_msg_t *msg, void *ctx);
+
+/**
+ * @brief Receive state of one end, zero initialize or motion_link_decoder_init().
+ */
+typedef struct {
+    uint8_t buf[MOTION_LINK_MAX_FRAME - 1];  /*!< frame after the sync byte */
+    uint8_t pos;            /*!< bytes in buf, 0 while looking for the sync byte */
+    bool hunting;           /*!< looking for the sync byte */
+    bool seq_valid;         /*!< next_seq is known (a frame was decoded) */
+    uint8_t next_seq;
+    motion_link_stats_t stats;
+} motion_link_decoder_t;
+
+/**
+ * @brief CRC-16/CCITT-FALSE (poly 0x1021), start with crc = 0xFFFF.
+ */
+uint16_t motion_link_crc16(const uint8_t *data, size_t len, uint16_t crc);
+
+/**
+ * @brief Build one frame in `out` (MOTION_LINK_MAX_FRAME bytes), returns its
+ * size or 0 when len is over MOTION_LINK_MAX_PAYLOAD.
+ */
+size_t motion_link_encode(uint8_t *out, uint8_t seq, uint8_t type, const void *payload, uint8_t len);
+
+void motion_link_decoder_init(motion_link_decoder_t *dec);
+
+/**
+ * @brief Feed received bytes, any split. `handler` is called for every frame
+ * with a good CRC, returns how many. A bad frame is dropped and the decoder
+ * looks for the next sync byte after its start, so a frame that began inside
+ * the bad one is still found.
+ */
+size_t motion_link_decode(motion_link_decoder_t *dec, const uint8_t *data, size_t len,
+                          motion_link_handler_t handler, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,45 @@
+#pragma once
+
+// ESP32 end of the motion link, see motion_link.h. A receive task decodes the
+// STM32 telemetry as it arrives; commands are framed and queued to the UART
+// driver from any task.
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_err.h"
+#include "motion_link.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Install the UART driver on CONFIG_HEXAPOD_LINK_UART_NUM and start
+ * the receive task.
+ */
+esp_err_t motion_link_uart_start(void);
+
+/**
+ * @brief Frame and send one message, returns without waiting for the wire.
+ * @param seq_out Optional, the seq the frame was sent with (see ack_seq).
+ */
+esp_err_t motion_link_uart_send(uint8_t type, const void *payload, uint8_t len, uint8_t *seq_out);
+
+/**
+ * @brief Latest telemetry, false before the first one arrived.
+ * @param age_us Optional, µs since it was received.
+ */
+bool motion_link_uart_telemetry(motion_link_telemetry_t *out, int64_t *age_us);
+
+/**
+ * @brief Send a PING and wait for its PONG, returns the round trip in µs or
+ * -1 on timeout.
+ */
+int64_t motion_link_uart_ping(uint32_t timeout_ms);
+
+/** @brief Receive counters of the ESP32 end */
+motion_link_stats_t motion_link_uart_rx_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
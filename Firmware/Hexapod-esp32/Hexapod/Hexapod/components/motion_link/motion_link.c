@@ -0,0 +1,124 @@
+#include <string.h>
+#include "motion_link.h"
+
+// CRC-16/CCITT-FALSE a nibble at a time: 32 bytes of table, fast enough for
+// 54 byte frames on both MCUs
+static const uint16_t crc_nibble[16] = {
+    0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7,
+    0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad, 0xe1ce, 0xf1ef,
+};
+
+uint16_t motion_link_crc16(const uint8_t *data, size_t len, uint16_t crc)
+{
+    for (size_t i = 0; i < len; i++) {
+        crc = (uint16_t)(crc << 4) ^ crc_nibble[(crc >> 12) ^ (data[i] >> 4)];
+        crc = (uint16_t)(crc << 4) ^ crc_nibble[(crc >> 12) ^ (data[i] & 0x0f)];
+    }
+    return crc;
+}
+
+size_t motion_link_encode(uint8_t *out, uint8_t seq, uint8_t type, const void *payload, uint8_t len)
+{
+    if (len > MOTION_LINK_MAX_PAYLOAD)
+        return 0;
+
+    out[0] = MOTION_LINK_SYNC;
+    out[1] = len;
+    out[2] = seq;
+    out[3] = type;
+    if (len)
+        memcpy(&out[4], payload, len);
+
+    uint16_t crc = motion_link_crc16(&out[1], 3 + len, 0xFFFF);
+    out[4 + len] = crc & 0xff;
+    out[5 + len] = crc >> 8;
+    return MOTION_LINK_OVERHEAD + len;
+}
+
+void motion_link_decoder_init(motion_link_decoder_t *dec)
+{
+    memset(dec, 0, sizeof(*dec));
+    dec->hunting = true;
+}
+
+// Drop buf[0..from) and look for the next sync byte in what is left
+static void resync(motion_link_decoder_t *dec, int from)
+{
+    for (int i = from; i < dec->pos; i++) {
+        if (dec->buf[i] == MOTION_LINK_SYNC) {
+            dec->pos -= i + 1;
+            memmove(dec->buf, &dec->buf[i + 1], dec->pos);
+            dec->hunting = false;
+            return;
+        }
+        dec->stats.skipped++;
+    }
+    dec->pos = 0;
+    dec->hunting = true;
+}
+
+// 0: frame incomplete, 1: frame delivered, -1: bad frame
+static int check(motion_link_decoder_t *dec, motion_link_handler_t handler, void *ctx, int *used)
+{
+    uint8_t len = dec->buf[0];
+    if (len > MOTION_LINK_MAX_PAYLOAD) {
+        dec->stats.len_errors++;
+        return -1;
+    }
+
+    int need = 3 + len + 2;
+    if (dec->pos < need)
+        return 0;
+
+    uint16_t crc = motion_link_crc16(dec->buf, 3 + len, 0xFFFF);
+    if (dec->buf[3 + len] != (crc & 0xff) || dec->buf[4 + len] != (crc >> 8)) {
+        dec->stats.crc_errors++;
+        return -1;
+    }
+
+    uint8_t seq = dec->buf[1];
+    if (dec->seq_valid)
+        dec->stats.lost += (uint8_t)(seq - dec->next_seq);
+    dec->seq_valid = true;
+    dec->next_seq = seq + 1;
+    dec->stats.frames++;
+
+    if (handler) {
+        motion_link_msg_t msg = { dec->buf[2], seq, len, &dec->buf[3] };
+        handler(&msg, ctx);
+    }
+    *used = need;
+    return 1;
+}
+
+size_t motion_link_decode(motion_link_decoder_t *dec, const uint8_t *data, size_t len,
+                          motion_link_handler_t handler, void *ctx)
+{
+    size_t frames = 0;
+
+    for (size_t i = 0; i < len; i++) {
+        if (dec->hunting) {
+            if (data[i] == MOTION_LINK_SYNC) {
+                dec->hunting = false;
+                dec->pos = 0;
+            } else {
+                dec->stats.skipped++;
+            }
+            continue;
+        }
+
+        dec->buf[dec->pos++] = data[i];
+
+        // after a resync the buffer may hold a whole frame, or the start of one
+        while (!dec->hunting && dec->pos > 0) {
+            int used = 0;
+            int r = check(dec, handler, ctx, &used);
+            if (r == 0)
+                break;
+            if (r > 0)
+                frames++;
+            resync(dec, used);
+        }
+    }
+    return frames;
+}
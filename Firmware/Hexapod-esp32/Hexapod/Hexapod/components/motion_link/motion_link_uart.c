@@ -0,0 +1,155 @@
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "driver/uart.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "motion_link_uart.h"
+
+static const char *TAG = "MOTION_LINK";
+
+#define LINK_PORT           CONFIG_HEXAPOD_LINK_UART_NUM
+#define RX_BUFFER_SIZE      1024
+#define TX_BUFFER_SIZE      512
+#define TASK_STACK          3072
+#define TASK_PRIORITY       8       // core 0: above httpd (5), below servo output (10)
+#define TASK_CORE           0
+
+static SemaphoreHandle_t tx_lock;
+static uint8_t tx_seq;
+
+static portMUX_TYPE rx_lock = portMUX_INITIALIZER_UNLOCKED;
+static motion_link_decoder_t decoder;
+static motion_link_telemetry_t telemetry;
+static int64_t telemetry_us;    // 0: none yet
+
+static TaskHandle_t ping_waiter;
+static uint32_t ping_id;
+static volatile int64_t ping_rtt_us;
+
+typedef struct __attribute__((packed)) {
+    uint32_t id;
+    int64_t sent_us;
+} ping_t;
+
+static void on_message(const motion_link_msg_t *msg, void *ctx)
+{
+    if (msg->type == MOTION_LINK_TELEMETRY && msg->len == sizeof(motion_link_telemetry_t)) {
+        portENTER_CRITICAL(&rx_lock);
+        memcpy(&telemetry, msg->payload, sizeof(telemetry));
+        telemetry_us = esp_timer_get_time();
+        portEXIT_CRITICAL(&rx_lock);
+    } else if (msg->type == MOTION_LINK_PONG && msg->len == sizeof(ping_t)) {
+        ping_t ping;
+        memcpy(&ping, msg->payload, sizeof(ping));
+        TaskHandle_t waiter = ping_waiter;
+        if (waiter && ping.id == ping_id) {
+            ping_rtt_us = esp_timer_get_time() - ping.sent_us;
+            xTaskNotifyGive(waiter);
+        }
+    }
+}
+
+static void rx_task(void *arg)
+{
+    uint8_t buf[128];
+
+    while (1) {
+        // the driver hands over what it has after the RX timeout (a few symbols
+        // of idle line), so a frame is decoded as soon as its last byte is in
+        int n = uart_read_bytes(LINK_PORT, buf, sizeof(buf), pdMS_TO_TICKS(20));
+        if (n <= 0)
+            continue;
+
+        motion_link_stats_t stats = decoder.stats;
+        motion_link_decode(&decoder, buf, n, on_message, NULL);
+        if (decoder.stats.crc_errors != stats.crc_errors || decoder.stats.len_errors != stats.len_errors)
+            ESP_LOGW(TAG, "dropped a bad frame (%lu crc, %lu length errors)",
+                     (unsigned long)decoder.stats.crc_errors, (unsigned long)decoder.stats.len_errors);
+    }
+}
+
+esp_err_t motion_link_uart_start(void)
+{
+    if (tx_lock)
+        return ESP_OK;
+
+    const uart_config_t config = {
+        .baud_rate = CONFIG_HEXAPOD_LINK_BAUD,
+        .data_bits = UART_DATA_8_BITS,
+        .parity = UART_PARITY_DISABLE,
+        .stop_bits = UART_STOP_BITS_1,
+        .flow_ctrl = UART_HW_FLOWCTRL_DISABLE,
+        .source_clk = UART_SCLK_DEFAULT,
+    };
+    ESP_ERROR_CHECK(uart_driver_install(LINK_PORT, RX_BUFFER_SIZE, TX_BUFFER_SIZE, 0, NULL, 0));
+    ESP_ERROR_CHECK(uart_param_config(LINK_PORT, &config));
+    ESP_ERROR_CHECK(uart_set_pin(LINK_PORT, CONFIG_HEXAPOD_LINK_TX, CONFIG_HEXAPOD_LINK_RX,
+                                 UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE));
+    // deliver after 2 idle symbols instead of the default 10
+    ESP_ERROR_CHECK(uart_set_rx_timeout(LINK_PORT, 2));
+
+    motion_link_decoder_init(&decoder);
+    tx_lock = xSemaphoreCreateMutex();
+
+    if (xTaskCreatePinnedToCore(rx_task, "motion_link", TASK_STACK, NULL, TASK_PRIORITY, NULL, TASK_CORE) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create link task");
+        return ESP_FAIL;
+    }
+    ESP_LOGI(TAG, "link on UART%d at %d baud", LINK_PORT, CONFIG_HEXAPOD_LINK_BAUD);
+    return ESP_OK;
+}
+
+esp_err_t motion_link_uart_send(uint8_t type, const void *payload, uint8_t len, uint8_t *seq_out)
+{
+    uint8_t frame[MOTION_LINK_MAX_FRAME];
+
+    if (!tx_lock)
+        return ESP_ERR_INVALID_STATE;
+    if (len > MOTION_LINK_MAX_PAYLOAD)
+        return ESP_ERR_INVALID_SIZE;
+
+    // seq and write order must agree, or the STM32 counts reordered frames as lost
+    xSemaphoreTake(tx_lock, portMAX_DELAY);
+    uint8_t seq = tx_seq++;
+    size_t size = motion_link_encode(frame, seq, type, payload, len);
+    int written = uart_write_bytes(LINK_PORT, frame, size);
+    xSemaphoreGive(tx_lock);
+
+    if (seq_out)
+        *seq_out = seq;
+    return written == (int)size ? ESP_OK : ESP_FAIL;
+}
+
+bool motion_link_uart_telemetry(motion_link_telemetry_t *out, int64_t *age_us)
+{
+    portENTER_CRITICAL(&rx_lock);
+    int64_t at = telemetry_us;
+    *out = telemetry;
+    portEXIT_CRITICAL(&rx_lock);
+
+    if (age_us)
+        *age_us = at ? esp_timer_get_time() - at : -1;
+    return at != 0;
+}
+
+int64_t motion_link_uart_ping(uint32_t timeout_ms)
+{
+    ping_t ping = { ++ping_id, 0 };
+
+    ping_waiter = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, 0);
+    ping.sent_us = esp_timer_get_time();
+    esp_err_t err = motion_link_uart_send(MOTION_LINK_PING, &ping, sizeof(ping), NULL);
+    bool answered = err == ESP_OK && ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeout_ms));
+    ping_waiter = NULL;
+
+    return answered ? ping_rtt_us : -1;
+}
+
+motion_link_stats_t motion_link_uart_rx_stats(void)
+{
+    return decoder.stats;
+}
@@ -0,0 +1,63 @@
+#include "body_pose.h"
+
+#include <cmath>
+
+namespace hexapod {
+
+    namespace {
+        constexpr float kDegToRad = 3.14159265f / 180.0f;
+    }
+
+    PoseTransform::PoseTransform(): m_{{1, 0, 0, 0}, {0, 1, 0, 0}, {0, 0, 1, 0}} {
+    }
+
+    PoseTransform::PoseTransform(const BodyPose& pose) {
+        float cr = std::cos(pose.roll * kDegToRad), sr = std::sin(pose.roll * kDegToRad);
+        float cp = std::cos(pose.pitch * kDegToRad), sp = std::sin(pose.pitch * kDegToRad);
+        float cy = std::cos(pose.yaw * kDegToRad), sy = std::sin(pose.yaw * kDegToRad);
+
+        // R = Rz(yaw) * Ry(pitch) * Rx(roll)
+        float r[3][3] = {
+            {cy * cp, cy * sp * sr - sy * cr, cy * sp * cr + sy * sr},
+            {sy * cp, sy * sp * sr + cy * cr, sy * sp * cr - cy * sr},
+            {-sp,     cp * sr,                cp * cr},
+        };
+        const float t[3] = {pose.x, pose.y, pose.z};
+
+        // rotation part R^T, translation -R^T * t
+        for (int i = 0; i < 3; i++) {
+            m_[i][3] = 0;
+            for (int j = 0; j < 3; j++) {
+                m_[i][j] = r[j][i];
+                m_[i][3] -= r[j][i] * t[j];
+            }
+        }
+    }
+
+    PoseTransform PoseTransform::operator*(const PoseTransform& b) const {
+        PoseTransform out;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 4; j++) {
+                float v = j == 3 ? m_[i][3] : 0;
+                for (int k = 0; k < 3; k++)
+                    v += m_[i][k] * b.m_[k][j];
+                out.m_[i][j] = v;
+            }
+        }
+        return out;
+    }
+
+    void PoseTransform::apply(const Point3D& in, Point3D& out) const {
+        out.x_ = m_[0][0] * in.x_ + m_[0][1] * in.y_ + m_[0][2] * in.z_ + m_[0][3];
+        out.y_ = m_[1][0] * in.x_ + m_[1][1] * in.y_ + m_[1][2] * in.z_ + m_[1][3];
+        out.z_ = m_[2][0] * in.x_ + m_[2][1] * in.y_ + m_[2][2] * in.z_ + m_[2][3];
+    }
+
+    Locations PoseTransform::apply(const Locations& in) const {
+        Point3D p[6];
+        for (int i = 0; i < 6; i++)
+            apply(in.get(i), p[i]);
+        return Locations{p[0], p[1], p[2], p[3], p[4], p[5]};
+    }
+
+}
@@ -0,0 +1,162 @@
+#include "gait_generator.h"
+#include "movement.h"
+#include "config.h"
+
+#include <cmath>
+
+namespace hexapod {
+
+    extern const MovementTable& standbyTable();
+
+    namespace {
+
+        constexpr float kPi = 3.14159265f;
+        constexpr float kDegToRad = kPi / 180.0f;
+
+        // a leg with less than this to go from and to home does not lift
+        constexpr float kIdleDistance = 0.5f;
+
+        // one frame advances the cycle at most this much, a longer stall
+        // slows the gait down instead of skipping a whole swing
+        constexpr float kMaxFrameCycle = 0.1f;
+
+        struct Pattern {
+            float duty;             // stance share of the cycle
+            float offset[6];        // per leg, foreRight .. foreLeft
+        };
+
+        // contralateral legs half a cycle apart, swings run hind to fore
+        const Pattern kPatterns[GAIT_TOTAL] = {
+            {1.0f/2, {0, 1.0f/2, 0, 1.0f/2, 0, 1.0f/2}},
+            {2.0f/3, {2.0f/3, 1.0f/3, 0, 1.0f/2, 5.0f/6, 1.0f/6}},
+            {5.0f/6, {2.0f/6, 1.0f/6, 0, 3.0f/6, 4.0f/6, 5.0f/6}},
+        };
+
+        const GaitParams kDefaultParams {0, 0, 0, 25, 50, GAIT_TRIPOD};
+
+        inline float wrap(float phase) {
+            return phase - std::floor(phase);
+        }
+
+        const Point3D& home(int leg) {
+            return standbyTable().table[0].get(leg);
+        }
+    }
+
+    GaitGenerator::GaitGenerator(): params_{kDefaultParams} {
+        reset();
+    }
+
+    void GaitGenerator::reset() {
+        cycle_ = 0;
+        for(int i=0; i<6; i++) {
+            foot_[i] = home(i);
+            swinging_[i] = false;
+            hold_[i] = false;
+            swing_[i] = 0;
+            swingRate_[i] = 0;
+        }
+        position_ = standbyTable().table[0];
+    }
+
+    void GaitGenerator::setParams(const GaitParams& params) {
+        GaitPattern previous = params_.pattern;
+        params_ = params;
+        if (params_.pattern < GAIT_TRIPOD || params_.pattern >= GAIT_TOTAL)
+            params_.pattern = GAIT_TRIPOD;
+
+        // a new pattern rephases the legs, a planted leg that lands inside
+        // its swing skips it rather than lift next to the legs already up
+        if (params_.pattern != previous) {
+            const Pattern& pattern = kPatterns[params_.pattern];
+            for(int i=0; i<6; i++)
+                hold_[i] = !swinging_[i] && wrap(cycle_ + pattern.offset[i]) >= pattern.duty;
+        }
+    }
+
+    const GaitParams& GaitGenerator::params() const {
+        return params_;
+    }
+
+    const Locations& GaitGenerator::next(float elapsedUs, float speed) {
+        const Pattern& pattern = kPatterns[params_.pattern];
+        const float cycleUs = config::gaitSwingDuration * 1000.0f / (1 - pattern.duty);
+
+        float dp = elapsedUs * speed / cycleUs;
+        if (dp > kMaxFrameCycle)
+            dp = kMaxFrameCycle;
+        cycle_ = wrap(cycle_ + dp);
+
+        // body velocity at each foot (mm per cycle) and the step that covers
+        // it, scaled down together when the longest step exceeds the stride
+        const float cycleS = cycleUs / speed * 1e-6f;
+        const float yaw = params_.yawRate * kDegToRad;
+        Point3D travel[6];
+        float longest = 0;
+        for(int i=0; i<6; i++) {
+            const Point3D& p = home(i);
+            travel[i] = Point3D((params_.vx - yaw * p.y_) * cycleS, (params_.vy + yaw * p.x_) * cycleS, 0);
+            float step = std::hypot(travel[i].x_, travel[i].y_) * pattern.duty;
+            if (step > longest)
+                longest = step;
+        }
+        if (longest > params_.stride && longest > 0) {
+            float scale = params_.stride / longest;
+            for(int i=0; i<6; i++)
+                travel[i] = travel[i] * scale;
+        }
+
+        Point3D p[6];
+        for(int i=0; i<6; i++) {
+            // planted feet move against the body, a swing lands half a step
+            // ahead of home
+            Point3D land = home(i);
+            land += travel[i] * (pattern.duty / 2);
+            float q = wrap(cycle_ + pattern.offset[i]);
+            if (q < pattern.duty)
+                hold_[i] = false;
+
+            if (swinging_[i]) {
+                swing_[i] += dp * swingRate_[i];
+                if (swing_[i] >= 1) {
+                    // touched down, the rest of the frame is stance
+                    foot_[i] = land;
+                    foot_[i] += travel[i] * -((swing_[i] - 1) / swingRate_[i]);
+                    swinging_[i] = false;
+                    hold_[i] = q >= pattern.duty;
+                }
+            }
+            else if (q >= pattern.duty && !hold_[i]) {
+                // lift off at the end of the stance, or right away for a leg
+                // reset() phased into its swing
+                float before = q - dp;
+                float stance = before >= 0 && before < pattern.duty ? pattern.duty - before : 0;
+                float start = stance > 0 ? pattern.duty : q;
+                foot_[i] += travel[i] * -stance;
+                swinging_[i] = true;
+                swingRate_[i] = 1 / (1 - start);
+                swing_[i] = (q - start) * swingRate_[i];
+            }
+            else {
+                foot_[i] += travel[i] * -dp;
+            }
+
+            p[i] = foot_[i];
+            if (swinging_[i]) {
+                // semicircle from the lift off point to the landing point
+                Point3D to = land - foot_[i];
+                float t = kPi * swing_[i];
+                p[i] += to * ((1 - std::cos(t)) / 2);
+
+                bool idle = std::hypot(to.x_, to.y_) < kIdleDistance
+                    && std::hypot(foot_[i].x_ - home(i).x_, foot_[i].y_ - home(i).y_) < kIdleDistance;
+                if (!idle)
+                    p[i].z_ += params_.stepHeight * std::sin(t);
+            }
+        }
+
+        position_ = Locations{p[0], p[1], p[2], p[3], p[4], p[5]};
+        return position_;
+    }
+
+}
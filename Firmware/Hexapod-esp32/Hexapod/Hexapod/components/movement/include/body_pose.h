@@ -0,0 +1,56 @@
+#pragma once
+
+#include "base.h"
+
+namespace hexapod {
+
+    // Body attitude and offset relative to the planted feet.
+    // Angles in degree (roll about X, pitch about Y, yaw about Z, applied
+    // Z-Y-X), offsets in mm. All zero is the plain gait.
+    struct BodyPose {
+        float roll;
+        float pitch;
+        float yaw;
+        float x;
+        float y;
+        float z;
+
+        bool isIdentity() const {
+            return roll == 0 && pitch == 0 && yaw == 0 && x == 0 && y == 0 && z == 0;
+        }
+    };
+
+    inline BodyPose operator-(const BodyPose& a, const BodyPose& b) {
+        return BodyPose{a.roll - b.roll, a.pitch - b.pitch, a.yaw - b.yaw, a.x - b.x, a.y - b.y, a.z - b.z};
+    }
+
+    inline BodyPose operator*(const BodyPose& a, float k) {
+        return BodyPose{a.roll * k, a.pitch * k, a.yaw * k, a.x * k, a.y * k, a.z * k};
+    }
+
+    inline BodyPose& operator+=(BodyPose& a, const BodyPose& b) {
+        a.roll += b.roll; a.pitch += b.pitch; a.yaw += b.yaw;
+        a.x += b.x; a.y += b.y; a.z += b.z;
+        return a;
+    }
+
+    // Affine 3x4 transform of tip positions in body coordinates:
+    //   tip' = R^T * (tip - t)
+    // for a body rotated by R and moved by t over fixed feet. Poses compose
+    // by multiplying transforms, so a whole frame is one pass over the tips.
+    class PoseTransform {
+    public:
+        PoseTransform();
+        explicit PoseTransform(const BodyPose& pose);
+
+        // (*this) after b: apply b first
+        PoseTransform operator*(const PoseTransform& b) const;
+
+        void apply(const Point3D& in, Point3D& out) const;
+        Locations apply(const Locations& in) const;
+
+    private:
+        float m_[3][4];
+    };
+
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "base.h"
+
+namespace hexapod {
+
+    enum GaitPattern {
+        GAIT_TRIPOD = 0,    // two groups of three legs, duty 1/2
+        GAIT_RIPPLE,        // one leg per side at a time, duty 2/3
+        GAIT_WAVE,          // one leg at a time, duty 5/6
+
+        GAIT_TOTAL,
+    };
+
+    // Body motion the generator walks, in body coordinates (x right, y
+    // forward). The stride caps the foot travel of a step: a velocity that
+    // needs longer steps at the current cadence is scaled down to fit.
+    struct GaitParams {
+        float vx;           // mm/s
+        float vy;           // mm/s
+        float yawRate;      // deg/s, positive turns left
+        float stepHeight;   // mm
+        float stride;       // mm
+        GaitPattern pattern;
+    };
+
+    // Foot trajectories computed on the fly instead of read from a table.
+    // Every leg walks the semicircle of pathTool's semicircle_generator: a
+    // straight stance against the body velocity at that foot, then a swing
+    // of stepHeight back over its home position. The cycle takes
+    // config::gaitSwingDuration / (1 - duty) ms at speed 1.
+    class GaitGenerator {
+    public:
+        GaitGenerator();
+
+        // Start over with every foot planted at home (the standby stance)
+        void reset();
+
+        void setParams(const GaitParams& params);
+        const GaitParams& params() const;
+
+        // Advance by elapsedUs of wall time, the cadence scaled by speed
+        const Locations& next(float elapsedUs, float speed);
+
+    private:
+        GaitParams params_;
+        float cycle_;           // 0 - 1, a leg's phase is cycle_ + its offset
+        Point3D foot_[6];       // planted foot, or where the swing lifted off
+        bool swinging_[6];
+        bool hold_[6];          // rephased into its swing, waits for the next one
+        float swing_[6];        // swing progress, 0 - 1
+        float swingRate_[6];    // swing progress per cycle
+        Locations position_;
+    };
+
+}
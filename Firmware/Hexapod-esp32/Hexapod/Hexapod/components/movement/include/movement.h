@@ -1,6 +1,10 @@
 #pragma once
 
+#include <stdint.h>
+
 #include "base.h"
+#include "body_pose.h"
+#include "gait_generator.h"
 
 namespace hexapod {
 
@@ -29,33 +33,117 @@ namespace hexapod {
         return m;
     }
 
+    // Gait keyframes packed by pathTool --compact: int16 offsets in 0.01 mm
+    // from the stance, one track per distinct leg path. Legs walking the same
+    // path half a cycle apart share a track and only differ in phase, leg i
+    // at keyframe k plays tracks[track[i]*length + (k + phase[i]) % length].
+    struct CompactTable {
+        const int16_t (*tracks)[3];
+        uint8_t track[6];
+        uint8_t phase[6];
+        const float (*stance)[3];       // the 6 tip locations offsets apply to
+        const int16_t (*joints)[18];    // pre-solved joints in 0.01 degree, may be null
+    };
+
+    // A table animates either the tip locations (table) or, for body motions
+    // over the standby stance, the body pose (poses, table is null).
+    // Frames between keyframes approach the next keyframe linearly, or follow
+    // a cubic through the neighbouring keyframes when spline is set, so a
+    // sparse table (pathTool --sparse) still draws a smooth foot path.
+    // A compact table leaves table and angles null, Movement decodes the few
+    // keyframes the current frame needs.
     struct MovementTable {
         const Locations* table;
         int length;
         int stepDuration;
         const int* entries;
         int entriesCount;
+        const JointAngles* angles;  // pre-solved joints per keyframe (pathTool --angles), may be null
+        const BodyPose* poses;      // body pose per keyframe, may be null
+        bool spline;                // cubic interpolation between keyframes
+        const CompactTable* compact;    // packed locations and angles, may be null
     };
 
     class Movement {
     public:
         Movement(MovementMode mode);
 
+        // Switch to a table. The transition is planned from the current frame
+        // to the closest of the table's entries: legs within a few mm slide
+        // there, the others are lifted and placed, one tripod at a time, as
+        // fast as the feet can move. A mode whose entry is reachable without
+        // a step takes over within a frame or two.
         void setMode(MovementMode newMode);
 
-        const Locations& next(int elapsed);
+        // Walk the runtime gait generator instead of a table until the next
+        // setMode(). Entering it eases over from the current frame; while it
+        // runs, new params take effect on the next frame.
+        void setGait(const GaitParams& params);
+        bool generated() const;
+
+        // true until the last mode switch reached the new table
+        bool transiting() const;
+
+        // Advance the gait clock by elapsedUs of wall time (scaled by the
+        // speed) and return the locations for that instant. Any control rate
+        // draws the same path; a frame longer than a keyframe step runs over
+        // it. 0 completes the current step at once.
+        const Locations& next(uint32_t elapsedUs);
+
+        // Pre-solved joint angles for the last next(), or null when the frame
+        // falls between keyframes (or the table has none) and needs IK.
+        const JointAngles* angles() const;
+
+        // Body pose of the current frame, to apply on the locations (identity
+        // for location tables once the mode transition settled)
+        const BodyPose& pose() const;
 
         // Speed control API
         void setSpeed(float speed);
         float getSpeed() const;
 
+    private:
+        // Lift and place plan from the frame a mode switch started at. Leg i
+        // moves over the window [start[i], end[i]] of the transition's phase.
+        struct Transition {
+            Locations from;
+            BodyPose fromPose;
+            float start[6];
+            float end[6];
+            float lift[6];      // mm the swing peaks above the straight line, 0 slides
+            float us;           // wall time of the whole transition
+        };
+
+        void planTransition(const MovementTable& table);
+        const Locations& nextTransition(const MovementTable& table, uint32_t elapsedUs);
+        const Locations& nextGenerated(uint32_t elapsedUs);
+
+        // Keyframe index of a location table (the standby stance for a pose
+        // table) and its joints, decoded on demand for a compact table
+        const Locations& keyframe(const MovementTable& table, int index);
+        const JointAngles* keyframeAngles(const MovementTable& table, int index);
+
     private:
         MovementMode mode_;
         Locations position_;
         int index_;             // index in mode position table
         bool transiting_;       // if still in transiting to new mode
-        int remainTime_;
+        float phase_;           // progress towards keyframe index_, 0 - 1
+        float carry_;           // phase the frame that landed on keyframe index_ was off by
         float speed_;           // speed multiplier, range: 0.25 - 1.0
+        const JointAngles* angles_; // table joints when position_ sits on a keyframe
+        BodyPose pose_;
+        Transition transition_;
+        GaitGenerator gait_;
+        bool generated_;        // gait_ drives position_ instead of the table
+
+        // keyframes decoded from a compact table: the segment a frame is on
+        // and its spline neighbours, index_ - 2 .. index_ + 1
+        static constexpr int kDecoded = 4;
+        const MovementTable* decodedTable_;
+        int decodedIndex_[kDecoded];
+        Locations decoded_[kDecoded];
+        JointAngles decodedAngles_;
     };
 
 }
\ No newline at end of file
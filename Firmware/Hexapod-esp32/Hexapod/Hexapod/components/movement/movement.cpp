@@ -2,7 +2,7 @@
 #include "debug.h"
 #include "config.h"
 
-#include <cstdlib>
+#include <cmath>
 static const char *TAG = "movement";
 
 namespace hexapod {
@@ -37,8 +37,109 @@ namespace hexapod {
         twistTable(),
     };
 
+    const BodyPose kIdentityPose {};
+
+    namespace {
+
+        // Cubic Hermite basis at t in [0, 1]: weights of p1, m1, p2, m2
+        struct HermiteBasis {
+            float h00, h10, h01, h11;
+
+            explicit HermiteBasis(float t) {
+                float t2 = t*t, t3 = t2*t;
+                h00 = 2*t3 - 3*t2 + 1;
+                h10 = t3 - 2*t2 + t;
+                h01 = -2*t3 + 3*t2;
+                h11 = t3 - t2;
+            }
+        };
+
+        // Catmull-Rom tangent at a keyframe limited as Fritsch-Carlson: zero at
+        // an extremum or next to a flat segment, at most 3x the smaller slope.
+        // Stance feet stay on the ground and the swing never overshoots.
+        inline float tangent(float before, float after) {
+            if (before * after <= 0)
+                return 0;
+            float m = (before + after) * 0.5f;
+            float limit = 3 * (std::fabs(before) < std::fabs(after) ? before : after);
+            return std::fabs(m) > std::fabs(limit) ? limit : m;
+        }
+
+        // Segment p1 -> p2 with neighbouring keyframes p0 and p3
+        inline float hermite(float p0, float p1, float p2, float p3, const HermiteBasis& h) {
+            float d = p2 - p1;
+            return h.h00*p1 + h.h10*tangent(p1 - p0, d) + h.h01*p2 + h.h11*tangent(d, p3 - p2);
+        }
+
+        Point3D hermite(const Point3D& p0, const Point3D& p1, const Point3D& p2, const Point3D& p3, const HermiteBasis& h) {
+            return Point3D(hermite(p0.x_, p1.x_, p2.x_, p3.x_, h),
+                           hermite(p0.y_, p1.y_, p2.y_, p3.y_, h),
+                           hermite(p0.z_, p1.z_, p2.z_, p3.z_, h));
+        }
+
+        Locations hermite(const Locations& p0, const Locations& p1, const Locations& p2, const Locations& p3, const HermiteBasis& h) {
+            Point3D p[6];
+            for(int i=0; i<6; i++)
+                p[i] = hermite(p0.get(i), p1.get(i), p2.get(i), p3.get(i), h);
+            return Locations{p[0], p[1], p[2], p[3], p[4], p[5]};
+        }
+
+        BodyPose hermite(const BodyPose& p0, const BodyPose& p1, const BodyPose& p2, const BodyPose& p3, const HermiteBasis& h) {
+            return BodyPose{
+                hermite(p0.roll, p1.roll, p2.roll, p3.roll, h),
+                hermite(p0.pitch, p1.pitch, p2.pitch, p3.pitch, h),
+                hermite(p0.yaw, p1.yaw, p2.yaw, p3.yaw, h),
+                hermite(p0.x, p1.x, p2.x, p3.x, h),
+                hermite(p0.y, p1.y, p2.y, p3.y, h),
+                hermite(p0.z, p1.z, p2.z, p3.z, h),
+            };
+        }
+
+        const Locations& locationAt(const MovementTable& table, int index) {
+            return table.table ? table.table[index] : kTable[MOVEMENT_STANDBY].table[0];
+        }
+
+        const BodyPose& poseAt(const MovementTable& table, int index) {
+            return table.poses ? table.poses[index] : kIdentityPose;
+        }
+
+        // least distance at which a frame lands on a keyframe, for the float
+        // rounding of the phase
+        constexpr float kPhaseSnap = 1e-3f;
+
+        constexpr float kPi = 3.14159265f;
+
+        // mode transitions: a leg closer than kSlideDistance to its entry
+        // slides there, a farther one steps at up to kFootSpeed, peaking
+        // kLiftHeight over the ground, and takes at least kMinSwingUs
+        constexpr float kSlideDistance = 3.0f;     // mm
+        constexpr float kFootSpeed = 5e-4f;        // mm per µs
+        constexpr float kLiftHeight = 20.0f;       // mm
+        constexpr float kMinSwingUs = 60000.0f;
+        constexpr float kBodyTurnSpeed = 1.2e-4f;  // degree per µs, pose tables
+
+        float distance(const Point3D& a, const Point3D& b) {
+            Point3D d = a - b;
+            return std::sqrt(d.x_*d.x_ + d.y_*d.y_ + d.z_*d.z_);
+        }
+
+        // rough size of a body pose change, degree and mm alike
+        float distance(const BodyPose& a, const BodyPose& b) {
+            BodyPose d = a - b;
+            float m = 0;
+            for (float v : {d.roll, d.pitch, d.yaw, d.x, d.y, d.z})
+                m = std::fmax(m, std::fabs(v));
+            return m;
+        }
+
+        inline float ease(float s) {
+            return (1 - std::cos(kPi * s)) / 2;
+        }
+    }
+
     Movement::Movement(MovementMode mode):
-        mode_{mode}, transiting_{false}, speed_{config::defaultSpeed}
+        mode_{mode}, position_{}, index_{0}, transiting_{false}, phase_{1}, carry_{0}, speed_{config::defaultSpeed}, angles_{nullptr}, pose_{}, transition_{}, gait_{}, generated_{false},
+        decodedTable_{nullptr}, decodedIndex_{}, decoded_{}, decodedAngles_{}
     {
     }
 
@@ -50,39 +151,297 @@ namespace hexapod {
         }
 
         mode_ = newMode;
+        generated_ = false;
 
         const MovementTable& table = kTable[mode_];
 
-        index_ = table.entries[std::rand() % table.entriesCount];
-        int actualDuration = (int)(table.stepDuration / speed_);
-        int actualSwitchDuration = (int)(config::movementSwitchDuration / speed_);
-        remainTime_ = actualSwitchDuration > actualDuration ? actualSwitchDuration : actualDuration;
+        planTransition(table);
     }
 
-    const Locations& Movement::next(int elapsed) {
+    void Movement::planTransition(const MovementTable& table) {
+        // the entry the current frame is closest to: least total foot travel,
+        // or least body motion for a pose table over the standby stance
+        float best = 0;
+        for (int e = 0; e < table.entriesCount; e++) {
+            int index = table.entries[e];
+            float cost = 0;
+            if (!table.poses) {
+                const Locations& entry = keyframe(table, index);
+                for (int i = 0; i < 6; i++)
+                    cost += distance(entry.get(i), position_.get(i));
+            } else {
+                cost = distance(poseAt(table, index), pose_);
+            }
+            if (e == 0 || cost < best) {
+                best = cost;
+                index_ = index;
+            }
+        }
+
+        const Locations& target = keyframe(table, index_);
+        Transition& t = transition_;
+        t.from = position_;
+        t.fromPose = pose_;
+
+        // legs off their entry step in two tripods (0, 2, 4 and 1, 3, 5), so
+        // three feet are always down. The tripod higher up, still in its
+        // swing, goes first.
+        float swingUs[2] = {0, 0};
+        float height[2] = {0, 0};
+        float slideUs = distance(poseAt(table, index_), pose_) / kBodyTurnSpeed;
+        bool stepping[6];
+        for (int i = 0; i < 6; i++) {
+            const Point3D& from = position_.get(i);
+            const Point3D& to = target.get(i);
+            float d = distance(from, to);
+            stepping[i] = d > kSlideDistance;
+            t.lift[i] = stepping[i] ? std::fmax(0, kLiftHeight - (from.z_ - to.z_)) : 0;
+            height[i % 2] += from.z_;
+            if (stepping[i])
+                swingUs[i % 2] = std::fmax(swingUs[i % 2], std::fmax(kMinSwingUs, d / kFootSpeed));
+            else
+                slideUs = std::fmax(slideUs, d / kFootSpeed);
+        }
+        int first = height[1] > height[0] ? 1 : 0;
+
+        t.us = std::fmax(swingUs[0] + swingUs[1], slideUs);
+        for (int i = 0; i < 6; i++) {
+            if (!stepping[i] || t.us <= 0) {
+                t.start[i] = 0;
+                t.end[i] = 1;
+            } else if (i % 2 == first) {
+                t.start[i] = 0;
+                t.end[i] = swingUs[first] / t.us;
+            } else {
+                t.start[i] = swingUs[first] / t.us;
+                t.end[i] = (swingUs[first] + swingUs[1 - first]) / t.us;
+            }
+        }
+
+        transiting_ = true;
+        phase_ = 0;
+    }
+
+    const Locations& Movement::nextTransition(const MovementTable& table, uint32_t elapsedUs) {
+        const Transition& t = transition_;
+        const Locations& target = keyframe(table, index_);
+        const BodyPose& targetPose = poseAt(table, index_);
+
+        // the switch runs on wall time, the gait speed does not slow it down
+        float to = elapsedUs && t.us > 0 ? phase_ + elapsedUs / t.us : 1;
+        if (to >= 1 - kPhaseSnap) {
+            position_ = target;
+            pose_ = targetPose;
+            angles_ = keyframeAngles(table, index_);
+            transiting_ = false;
+            phase_ = 1;
+            carry_ = 0;
+
+            // the gait starts on the entry keyframe. The rest of the frame
+            // only counts in whole steps: a fraction of a step would leave
+            // every later frame off the keyframes and their angles.
+            float overUs = to > 1 ? (to - 1) * t.us : 0;
+            int steps = (int)(overUs * speed_ / (table.stepDuration * 1000.0f));
+            if (steps > 0) {
+                index_ = (index_ + steps) % table.length;
+                position_ = keyframe(table, index_);
+                pose_ = poseAt(table, index_);
+                angles_ = keyframeAngles(table, index_);
+            }
+            return position_;
+        }
+
+        Point3D p[6];
+        for (int i = 0; i < 6; i++) {
+            float s = (to - t.start[i]) / (t.end[i] - t.start[i]);
+            s = s < 0 ? 0 : (s > 1 ? 1 : s);
+            p[i] = t.from.get(i);
+            p[i] += (target.get(i) - t.from.get(i)) * ease(s);
+            p[i].z_ += t.lift[i] * std::sin(kPi * s);
+        }
+        position_ = Locations{p[0], p[1], p[2], p[3], p[4], p[5]};
+        pose_ = t.fromPose;
+        pose_ += (targetPose - t.fromPose) * ease(to);
+        angles_ = nullptr;
+        phase_ = to;
+        return position_;
+    }
+
+    const Locations& Movement::keyframe(const MovementTable& table, int index) {
+        const CompactTable* compact = table.compact;
+        if (!compact)
+            return locationAt(table, index);
+
+        if (decodedTable_ != &table) {
+            decodedTable_ = &table;
+            for (int s = 0; s < kDecoded; s++)
+                decodedIndex_[s] = -1;
+        }
+
+        for (int s = 0; s < kDecoded; s++)
+            if (decodedIndex_[s] == index)
+                return decoded_[s];
+
+        // a miss replaces a keyframe outside the window around index_, so the
+        // ones a spline segment holds on to stay put
+        const int n = table.length;
+        int slot = 0;
+        for (int s = 0; s < kDecoded; s++)
+            if (decodedIndex_[s] < 0 || (decodedIndex_[s] - index_ + n + 2) % n >= kDecoded)
+                slot = s;
+
+        Point3D p[6];
+        for (int i = 0; i < 6; i++) {
+            const int16_t* offset = compact->tracks[compact->track[i] * n + (index + compact->phase[i]) % n];
+            const float* stance = compact->stance[i];
+            p[i] = Point3D(stance[0] + offset[0] * 0.01f, stance[1] + offset[1] * 0.01f, stance[2] + offset[2] * 0.01f);
+        }
+        decoded_[slot] = Locations{p[0], p[1], p[2], p[3], p[4], p[5]};
+        decodedIndex_[slot] = index;
+        return decoded_[slot];
+    }
+
+    const JointAngles* Movement::keyframeAngles(const MovementTable& table, int index) {
+        if (!table.compact)
+            return table.angles ? &table.angles[index] : nullptr;
+        if (!table.compact->joints)
+            return nullptr;
+
+        const int16_t* joints = table.compact->joints[index];
+        for (int i = 0; i < 6; i++)
+            for (int j = 0; j < 3; j++)
+                decodedAngles_.angles[i][j] = joints[i*3 + j] * 0.01f;
+        return &decodedAngles_;
+    }
+
+    void Movement::setGait(const GaitParams& params) {
+        gait_.setParams(params);
+        if (generated_)
+            return;
+
+        gait_.reset();
+        generated_ = true;
+        transiting_ = true;
+        phase_ = 0;
+    }
+
+    bool Movement::transiting() const {
+        return transiting_;
+    }
+
+    bool Movement::generated() const {
+        return generated_;
+    }
+
+    const Locations& Movement::next(uint32_t elapsedUs) {
+
+        if (generated_)
+            return nextGenerated(elapsedUs);
 
         const MovementTable& table = kTable[mode_];
+        if (transiting_)
+            return nextTransition(table, elapsedUs);
+
+        // the last frame landed on the keyframe, head for the next one
+        if (phase_ >= 1) {
+            index_ = (index_ + 1)%table.length;
+            phase_ = carry_;
+            carry_ = 0;
+        }
 
-        // Calculate actual step duration based on speed
-        int actualStepDuration = (int)(table.stepDuration / speed_);
+        // wall time of a step at speed 1
+        const float step = table.stepDuration * 1000.0f;
+        float from = phase_;
+        float to = elapsedUs ? phase_ + elapsedUs * speed_ / step : 1;
 
-        if (elapsed <= 0)
-            elapsed = actualStepDuration;
+        // The frame closest to a keyframe lands on it: one within half a frame
+        // of it, whatever the frame rate, speed and jitter. The phase it is
+        // moved by is carried into the next step, so the gait keeps time.
+        const float snap = std::fmax((to - from) / 2, kPhaseSnap);
 
-        if (remainTime_ <= 0) {
+        // a frame longer than the rest of the step runs over keyframe index_,
+        // the remaining time goes on in the following step
+        for (int skipped = 0; to > 1 + snap && skipped < table.length; skipped++) {
+            position_ = keyframe(table, index_);
+            pose_ = poseAt(table, index_);
             index_ = (index_ + 1)%table.length;
-            remainTime_ = actualStepDuration;
+            from = 0;
+            to -= 1;
         }
-        if (elapsed >= remainTime_)
-            elapsed = remainTime_;
 
-        auto ratio = (float)elapsed / remainTime_;
-        position_ += (table.table[index_] - position_)*ratio;
-        remainTime_ -= elapsed;
+        // pose tables move the body over the standby stance
+        const Locations& target = keyframe(table, index_);
+        const BodyPose& targetPose = poseAt(table, index_);
+
+        // A frame that lands on a keyframe can use the table's pre-solved joints,
+        // frames in between are interpolated in Cartesian space and need IK.
+        if (to >= 1 - snap) {
+            position_ = target;
+            pose_ = targetPose;
+            angles_ = keyframeAngles(table, index_);
+            carry_ = to - 1;
+            to = 1;
+        }
+        else if (table.spline) {
+            // the phase is absolute on the segment from the previous keyframe,
+            // so the curve does not depend on how the frames fall into it
+            int n = table.length;
+            int i1 = (index_ + n - 1) % n;
+            int i0 = (index_ + n - 2) % n;
+            int i3 = (index_ + 1) % n;
+            HermiteBasis h(std::fmax(to, 0.0f));
+
+            position_ = hermite(keyframe(table, i0), keyframe(table, i1), target, keyframe(table, i3), h);
+            pose_ = hermite(poseAt(table, i0), poseAt(table, i1), targetPose, poseAt(table, i3), h);
+            angles_ = nullptr;
+        }
+        else {
+            auto ratio = (to - from) / (1 - from);
+            position_ += (target - position_)*ratio;
+            pose_ += (targetPose - pose_)*ratio;
+            angles_ = nullptr;
+        }
+        phase_ = to;
 
         return position_;
     }
 
+    const Locations& Movement::nextGenerated(uint32_t elapsedUs) {
+        const Locations& target = gait_.next(elapsedUs, speed_);
+        angles_ = nullptr;
+
+        if (!transiting_) {
+            position_ = target;
+            return position_;
+        }
+
+        // ease over from the last table frame like a mode switch, onto the
+        // generated feet that are already walking
+        float from = phase_;
+        float to = elapsedUs ? phase_ + elapsedUs * speed_ / (config::movementSwitchDuration * 1000.0f) : 1;
+        if (to >= 1 - kPhaseSnap) {
+            position_ = target;
+            pose_ = kIdentityPose;
+            transiting_ = false;
+            phase_ = 1;
+        }
+        else {
+            auto ratio = (to - from) / (1 - from);
+            position_ += (target - position_)*ratio;
+            pose_ += (kIdentityPose - pose_)*ratio;
+            phase_ = to;
+        }
+        return position_;
+    }
+
+    const JointAngles* Movement::angles() const {
+        return angles_;
+    }
+
+    const BodyPose& Movement::pose() const {
+        return pose_;
+    }
+
     void Movement::setSpeed(float speed) {
         // Clamp speed to valid range
         if (speed < config::minSpeed)
@@ -22,6 +22,7 @@
 #ifndef PCA9685_DRIVER_H
 #define PCA9685_DRIVER_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "esp_err.h"
 #include "driver/i2c_master.h"
@@ -49,11 +50,49 @@ extern "C" {
 #define PRE_SCALE       0xFE
 #define CLOCK_FREQ      25000000.0
 
+#define MODE1_AI        0x20    /*!< MODE1 register auto-increment */
+#define PCA9685_CHANNELS 16
+
 typedef struct {
     i2c_master_dev_handle_t device_handle;
     uint8_t address;
 } pca9685_t;
 
+/**
+ * @brief Clean channels bridged to merge two dirty runs into one burst.
+ * A bridged channel costs 4 bytes, a separate transaction costs the address,
+ * register and start/stop plus the per-transfer driver overhead.
+ */
+#define PCA9685_FRAME_MAX_GAP 2
+
+/**
+ * @brief Output counters of a frame, accumulated by pca9685_frame_commit().
+ * Sets and channels written compare against one 6 byte transaction per set.
+ */
+typedef struct {
+    uint32_t commits;           /*!< pca9685_frame_commit() calls */
+    uint32_t skipped;           /*!< commits with no changed channel, bus untouched */
+    uint32_t transactions;      /*!< bursts written */
+    uint32_t bytes;             /*!< bytes on the wire, address and register included */
+    uint32_t channels_set;      /*!< pca9685_frame_set() calls */
+    uint32_t channels_written;  /*!< channels sent, bridged ones included */
+} pca9685_frame_stats_t;
+
+/**
+ * @brief Off ticks of all channels of one board, staged for pca9685_frame_commit(),
+ * with a shadow of what the board was last sent. Channels are driven with on = 0.
+ * Zero initialize; pca9685_set_pwm() bypasses the shadow, call
+ * pca9685_frame_invalidate() after writing the board any other way.
+ */
+typedef struct {
+    uint16_t off[PCA9685_CHANNELS];
+    uint16_t shadow[PCA9685_CHANNELS];  /*!< off ticks last written to the board */
+    uint16_t valid;     /*!< bit n: shadow[n] matches the board */
+    uint16_t dirty;     /*!< bit n: off[n] differs from the board */
+    pca9685_frame_stats_t stats;
+    uint8_t tx[PCA9685_CHANNELS * (LED_MULTIPLYER + 1)];   /*!< bursts of the last commit, register first */
+} pca9685_frame_t;
+
 /**
  * @brief Initialize the PCA9685 driver.
  */
@@ -74,6 +113,16 @@ esp_err_t pca9685_reset(pca9685_t *pca);
  */
 esp_err_t pca9685_set_frequency(pca9685_t *pca, uint16_t freq);
 
+/**
+ * @brief PRE_SCALE register value pca9685_set_frequency() writes for freq.
+ */
+uint8_t pca9685_prescale(uint16_t freq);
+
+/**
+ * @brief Length of one of the 4096 PWM ticks in µs at freq (prescale rounding included).
+ */
+float pca9685_tick_us(uint16_t freq);
+
 /**
  * @brief Turn all 16 channels fully off.
  */
@@ -84,6 +133,35 @@ esp_err_t pca9685_turn_all_off(pca9685_t *pca);
  */
 esp_err_t pca9685_set_pwm(pca9685_t *pca, uint8_t num, uint16_t on, uint16_t off);
 
+/**
+ * @brief Set or clear the MODE1 auto-increment bit (read-modify-write).
+ * pca9685_frame_commit() relies on it being set.
+ */
+esp_err_t pca9685_set_auto_increment(pca9685_t *pca, bool enable);
+
+/**
+ * @brief Stage the off value of one channel in a frame (no bus access).
+ * The channel only becomes dirty when the value differs from the shadow.
+ */
+void pca9685_frame_set(pca9685_frame_t *frame, uint8_t num, uint16_t off);
+
+/**
+ * @brief Write the dirty channels of a frame as auto-increment bursts.
+ * Runs of dirty channels separated by at most PCA9685_FRAME_MAX_GAP clean
+ * channels go out as one burst starting at the LEDn_ON_L of the run. Nothing
+ * is sent when no channel changed. On error the unwritten runs stay dirty.
+ *
+ * The bursts are sent from frame->tx. On a bus with event callbacks registered
+ * (asynchronous i2c_master) they are only queued: the stats.transactions delta
+ * is the number of completions to wait for before the next commit of this frame.
+ */
+esp_err_t pca9685_frame_commit(pca9685_t *pca, pca9685_frame_t *frame);
+
+/**
+ * @brief Forget the shadow, the next commit rewrites every channel sent so far.
+ */
+void pca9685_frame_invalidate(pca9685_frame_t *frame);
+
 /**
  * @brief Get the current PWM on/off values for a single channel.
  */
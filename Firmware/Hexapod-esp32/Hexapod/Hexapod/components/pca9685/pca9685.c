@@ -126,6 +126,16 @@ esp_err_t pca9685_reset(pca9685_t *pca)
     return ret;
 }
 
+uint8_t pca9685_prescale(uint16_t freq)
+{
+    return round((float)CLOCK_FREQ / (4096.0f * (float)freq)) - 1;
+}
+
+float pca9685_tick_us(uint16_t freq)
+{
+    return (pca9685_prescale(freq) + 1) * (1000000.0f / (float)CLOCK_FREQ);
+}
+
 esp_err_t pca9685_set_frequency(pca9685_t *pca, uint16_t freq)
 {
     esp_err_t ret;
@@ -139,7 +149,7 @@ esp_err_t pca9685_set_frequency(pca9685_t *pca, uint16_t freq)
     ret = i2c_write(pca, MODE1, &new_mode, 1);
     if (ret != ESP_OK) return ret;
 
-    uint8_t prescale_val = round((float)CLOCK_FREQ / (4096.0f * (float)freq)) - 1;
+    uint8_t prescale_val = pca9685_prescale(freq);
     ret = i2c_write(pca, PRE_SCALE, &prescale_val, 1);
     if (ret != ESP_OK) return ret;
 
@@ -165,6 +175,96 @@ esp_err_t pca9685_set_pwm(pca9685_t *pca, uint8_t num, uint16_t on, uint16_t off
     return i2c_write(pca, reg_addr, buffer, 4);
 }
 
+esp_err_t pca9685_set_auto_increment(pca9685_t *pca, bool enable)
+{
+    uint8_t mode;
+    esp_err_t ret = i2c_read(pca, MODE1, &mode, 1);
+    if (ret != ESP_OK) return ret;
+
+    // writing back RESTART (bit 7) as 1 would restart the PWM channels
+    mode &= 0x7F;
+    mode = enable ? (mode | MODE1_AI) : (mode & ~MODE1_AI);
+    return i2c_write(pca, MODE1, &mode, 1);
+}
+
+void pca9685_frame_set(pca9685_frame_t *frame, uint8_t num, uint16_t off)
+{
+    if (num >= PCA9685_CHANNELS) return;
+
+    uint16_t bit = 1u << num;
+    frame->off[num] = off;
+    frame->stats.channels_set++;
+    if ((frame->valid & bit) && frame->shadow[num] == off)
+        frame->dirty &= ~bit;
+    else
+        frame->dirty |= bit;
+}
+
+esp_err_t pca9685_frame_commit(pca9685_t *pca, pca9685_frame_t *frame)
+{
+    frame->stats.commits++;
+    if (!frame->dirty) {
+        frame->stats.skipped++;
+        return ESP_OK;
+    }
+
+    if (pca->device_handle == NULL) {
+        ESP_LOGE(TAG, "Driver not initialized");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // runs are laid out back to back in frame->tx, the driver may still be
+    // reading an earlier run while a later one is queued
+    uint8_t *buffer = frame->tx;
+    uint16_t pending = frame->dirty;
+    while (pending) {
+        int first = __builtin_ctz(pending);
+        int last = first;
+
+        // extend the run over short gaps, only across channels whose shadow
+        // is valid so the bridged value is what the board already has
+        while (last + 1 < PCA9685_CHANNELS) {
+            uint16_t ahead = pending >> (last + 1);
+            if (!ahead) break;
+            int gap = __builtin_ctz(ahead);
+            uint16_t gap_mask = ((1u << gap) - 1) << (last + 1);
+            if (gap > PCA9685_FRAME_MAX_GAP || (frame->valid & gap_mask) != gap_mask) break;
+            last += gap + 1;
+        }
+
+        size_t len = 0;
+        buffer[len++] = LED0_ON_L + (LED_MULTIPLYER * first);
+        for (int i = first; i <= last; i++) {
+            buffer[len++] = 0;
+            buffer[len++] = 0;
+            buffer[len++] = frame->off[i] & 0xFF;
+            buffer[len++] = frame->off[i] >> 8;
+        }
+
+        esp_err_t ret = i2c_master_transmit(pca->device_handle, buffer, len, -1);
+        if (ret != ESP_OK) return ret;
+        buffer += len;
+
+        uint16_t run = (uint16_t)(((1u << (last - first + 1)) - 1) << first);
+        for (int i = first; i <= last; i++)
+            frame->shadow[i] = frame->off[i];
+        frame->valid |= run;
+        frame->dirty &= ~run;
+        pending &= ~run;
+
+        frame->stats.transactions++;
+        frame->stats.bytes += len + 1;
+        frame->stats.channels_written += last - first + 1;
+    }
+    return ESP_OK;
+}
+
+void pca9685_frame_invalidate(pca9685_frame_t *frame)
+{
+    frame->dirty |= frame->valid;
+    frame->valid = 0;
+}
+
 esp_err_t pca9685_get_pwm(pca9685_t *pca, uint8_t num, uint16_t* dataOn, uint16_t* dataOff)
 {
     if (num > 15 || !dataOn || !dataOff) return ESP_ERR_INVALID_ARG;
@@ -1,20 +1,14 @@
 #pragma once
 
 #include "pca9685.h"
-#include <driver/i2c_master.h>
-
-#define I2C_MASTER_SCL_IO   GPIO_NUM_9    /*!< GPIO number for I2C master clock */
-#define I2C_MASTER_SDA_IO   GPIO_NUM_8    /*!< GPIO number for I2C master data */
-#define I2C_MASTER_NUM      I2C_NUM_0 /*!< I2C port number for master */
-#define I2C_ADDRESS_PCA9685_0 0x40  /*!< PCA9685 board 0 address */
-#define I2C_ADDRESS_PCA9685_1 0x41  /*!< PCA9685 board 1 address */
+#include "servo_topology.h"
 
 namespace hexapod {
 
 class Servo {
 public:
     /** 
-     * @brief Initialize PCA9685 boards and I2C bus. 
+     * @brief Initialize PCA9685 boards and I2C buses. 
      * Must be called once before any Servo is used.
      */
     static void init();
@@ -32,25 +26,58 @@ public:
           bool inverse = false,
           float range = 60.0f);
 
-    /** @brief Set the desired angle of the servo in degrees */
+    /**
+     * @brief Set the desired angle of the servo in degrees.
+     * Only stages the channel in its board's frame, see commit().
+     */
     void setAngle(float angle);
 
+    /**
+     * @brief Write the staged frame of all boards, one I2C burst per run of
+     * changed channels. Call once after all servos of a control frame have been
+     * set. With ServoOutput running this hands the frame over and returns.
+     */
+    static void commit();
+
+    /** @brief Output counters of all boards summed, see pca9685_frame_stats_t */
+    static pca9685_frame_stats_t outputStats();
+
+    /** @brief Zero the output counters */
+    static void resetOutputStats();
+
+    /**
+     * @brief Convert a joint angle to PCA9685 off ticks (no bus access).
+     * Clamps to the legal range and interpolates the tick table, which has
+     * adjustment, inversion and the pulse offset folded in.
+     */
+    int angleToTicks(float angle) const;
+
     /** @brief Get the last set angle of the servo */
     float getAngle() const;
 
-    /** @brief Set an offset for the servo (in µs) */
+    /** @brief Set an offset for the servo (in µs), rebuilds the tick table */
     void setOffset(float offset);
 
     /** @brief Get the current offset */
     float getOffset() const;
 
 private:
-    int pwmIndex_;        /*!< PCA9685 channel index */
+    static constexpr float kTableStep = 2.0f;   /*!< Degrees between tick table entries */
+    static constexpr int kTableSize = 91;       /*!< Covers a range up to 90 degrees */
+
+    /** @brief Recompute ticks_ from adjustment, inversion, range and offset */
+    void buildTable();
+
+    int pwmIndex_;        /*!< Servo channel, board * 16 + PCA9685 output */
     bool inverse_;        /*!< Whether motion is inverted */
     float adjust_angle_;  /*!< Mechanical adjustment */
     float range_;         /*!< Max allowed angle */
     float angle_;         /*!< Last set angle */
     float offset_;        /*!< Pulse offset in µs */
+    float minAngle_;      /*!< Legal input angles, range_ around adjust_angle_ */
+    float maxAngle_;
+    int tableLast_;       /*!< Index of the last entry in ticks_ */
+    float ticks_[kTableSize]; /*!< Off ticks from minAngle_ every kTableStep degrees */
 };
 
 } // namespace hexapod
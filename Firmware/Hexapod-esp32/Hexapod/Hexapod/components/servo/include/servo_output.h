@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace hexapod {
+
+/**
+ * @brief Servo output task, overlaps the I2C transfer of frame N with the
+ * computation of frame N+1.
+ *
+ * Once started, the task owns the I2C buses and runs them in the driver's
+ * asynchronous mode. Servo::commit() then only copies the staged frame into
+ * a lock-free triple buffer and returns. The task takes the newest frame,
+ * queues one burst per dirty run on every board and sleeps until the
+ * completion callbacks have fired, while the next frame is staged. Boards on
+ * different buses (see servo_topology.h) are on the wire at the same time. A
+ * frame committed before the task took the previous one replaces it, the task
+ * then stages every channel ever set and the newest value of each channel wins.
+ */
+class ServoOutput {
+public:
+    struct Stats {
+        uint32_t submitted;   /*!< Servo::commit() calls handed to the task */
+        uint32_t merged;      /*!< commits replaced by a newer one before the task took them */
+        uint32_t written;     /*!< frames the task put on the bus */
+        uint32_t errors;      /*!< frames with a failed or NACKed transfer, shadow dropped */
+    };
+
+    /**
+     * @brief Reopen the bus asynchronous and start the task.
+     * Servo::init() must have run. No-op when already running.
+     */
+    static void start();
+
+    /** @brief Drain, stop the task and return the bus to blocking commits */
+    static void stop();
+
+    static bool running();
+
+    /** @brief Wait until every committed frame is on the wire */
+    static void flush();
+
+    static Stats stats();
+};
+
+} // namespace hexapod
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <stdint.h>
+#include <driver/i2c_master.h>
+#include "pca9685.h"
+#include "sdkconfig.h"
+
+#define I2C_MASTER_SCL_IO   GPIO_NUM_9    /*!< GPIO number for I2C master clock */
+#define I2C_MASTER_SDA_IO   GPIO_NUM_8    /*!< GPIO number for I2C master data */
+#define I2C_MASTER_NUM      I2C_NUM_0 /*!< I2C port number for master */
+#define I2C_ADDRESS_PCA9685_0 0x40  /*!< PCA9685 board 0 address */
+#define I2C_ADDRESS_PCA9685_1 0x41  /*!< PCA9685 board 1 address */
+
+namespace hexapod {
+
+// Where the servo boards hang. Boards on different buses are written
+// concurrently by ServoOutput, so a frame costs the slowest bus, not the sum.
+//
+// A servo channel is board * 16 + PCA9685 output. The legs use the first two
+// boards; more servos (head, gripper) get channels on further boards by
+// appending to kBoards.
+namespace topology {
+
+    struct Bus {
+        i2c_port_num_t port;
+        gpio_num_t sda;
+        gpio_num_t scl;
+    };
+
+    struct Board {
+        int bus;            /*!< Index into kBuses */
+        uint8_t address;
+    };
+
+#if CONFIG_HEXAPOD_SERVO_SPLIT_BUS
+    constexpr Bus kBuses[] = {
+        { I2C_MASTER_NUM, I2C_MASTER_SDA_IO, I2C_MASTER_SCL_IO },
+        { I2C_NUM_1, (gpio_num_t)CONFIG_HEXAPOD_SERVO_BUS1_SDA, (gpio_num_t)CONFIG_HEXAPOD_SERVO_BUS1_SCL },
+    };
+
+    constexpr Board kBoards[] = {
+        { 0, I2C_ADDRESS_PCA9685_1 },
+        { 1, I2C_ADDRESS_PCA9685_0 },
+    };
+#else
+    constexpr Bus kBuses[] = {
+        { I2C_MASTER_NUM, I2C_MASTER_SDA_IO, I2C_MASTER_SCL_IO },
+    };
+
+    constexpr Board kBoards[] = {
+        { 0, I2C_ADDRESS_PCA9685_1 },
+        { 0, I2C_ADDRESS_PCA9685_0 },
+    };
+#endif
+
+    constexpr int kBusCount = sizeof(kBuses) / sizeof(kBuses[0]);
+    constexpr int kBoardCount = sizeof(kBoards) / sizeof(kBoards[0]);
+    constexpr int kChannelCount = kBoardCount * PCA9685_CHANNELS;
+
+    // (leg, joint) -> servo channel
+    constexpr int kLegChannels[6][3] = {
+        {5, 6, 7},       // Leg 0
+        {2, 3, 4},       // Leg 1
+        {8, 9, 10},      // Leg 2
+        {24, 25, 26},    // Leg 3 (16+8+0..2)
+        {18, 19, 20},    // Leg 4 (16+2+0..2)
+        {21, 22, 23}     // Leg 5 (16+5+0..2)
+    };
+
+    constexpr bool valid() {
+        for (const Board& b : kBoards)
+            if (b.bus < 0 || b.bus >= kBusCount) return false;
+        for (int i = 0; i < kBoardCount; i++)
+            for (int j = i + 1; j < kBoardCount; j++)
+                if (kBuses[kBoards[i].bus].port == kBuses[kBoards[j].bus].port && kBoards[i].address == kBoards[j].address)
+                    return false;
+        for (const auto& leg : kLegChannels)
+            for (int channel : leg)
+                if (channel < 0 || channel >= kChannelCount) return false;
+        return true;
+    }
+    static_assert(valid(), "servo topology: bad bus index, duplicate board or channel out of range");
+}
+
+} // namespace hexapod
@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include "pca9685.h"
+#include "sdkconfig.h"
+#include <driver/i2c_master.h>
+#include <esp_log.h>
+#include <mutex>
+#include "servo.h"
+#include "servo_bus.h"
+
+namespace hexapod {
+
+namespace {
+
+static const char* TAG = "SERVO";
+
+// Thread-safe initialization
+bool pwmInited = false;
+std::mutex pwmInitMutex;
+i2c_master_bus_handle_t busHandles[topology::kBusCount];
+
+// Initialize I2C bus
+i2c_master_bus_handle_t i2c_init(const topology::Bus& bus, size_t queueDepth) {
+    ESP_LOGI(TAG, "Initializing I2C Master Bus %d...", (int)bus.port);
+
+    // C++ does not accept the nested designated initializers used in the C examples
+    i2c_master_bus_config_t bus_config = {};
+    bus_config.i2c_port = bus.port;
+    bus_config.sda_io_num = bus.sda;
+    bus_config.scl_io_num = bus.scl;
+    bus_config.clk_source = I2C_CLK_SRC_DEFAULT;
+    bus_config.glitch_ignore_cnt = 7;
+    bus_config.intr_priority = 0;
+    bus_config.trans_queue_depth = queueDepth;
+    bus_config.flags.enable_internal_pullup = 1;
+
+    i2c_master_bus_handle_t handle;
+    ESP_ERROR_CHECK(i2c_new_master_bus(&bus_config, &handle));
+    return handle;
+}
+
+// Initialize PCA9685 boards
+void initPWM() {
+    std::lock_guard<std::mutex> lock(pwmInitMutex);
+    if (pwmInited) return;
+
+    servo_bus::open(0);
+
+    for (int b = 0; b < servo_bus::kBoards; b++) {
+        ESP_ERROR_CHECK(pca9685_reset(&servo_bus::boards[b]));
+        ESP_ERROR_CHECK(pca9685_set_frequency(&servo_bus::boards[b], servo_bus::kFrequency));
+
+        // frame commits write all channels of a board in one burst
+        ESP_ERROR_CHECK(pca9685_set_auto_increment(&servo_bus::boards[b], true));
+    }
+
+    pwmInited = true;
+}
+
+} // namespace
+
+namespace servo_bus {
+
+pca9685_t boards[kBoards];
+pca9685_frame_t frames[kBoards];
+
+void open(size_t queueDepth) {
+    for (int i = 0; i < topology::kBusCount; i++)
+        busHandles[i] = i2c_init(topology::kBuses[i], queueDepth);
+    for (int b = 0; b < kBoards; b++) {
+        const topology::Board& board = topology::kBoards[b];
+        ESP_ERROR_CHECK(pca9685_init(&boards[b], busHandles[board.bus], board.address));
+    }
+}
+
+void close() {
+    for (int b = 0; b < kBoards; b++)
+        ESP_ERROR_CHECK(pca9685_deinit(&boards[b]));
+    for (int i = 0; i < topology::kBusCount; i++)
+        ESP_ERROR_CHECK(i2c_del_master_bus(busHandles[i]));
+}
+
+void stage(const Frame& frame) {
+    for (int b = 0; b < kBoards; b++) {
+        uint32_t set = frame.set[b];
+        while (set) {
+            int n = __builtin_ctz(set);
+            set &= set - 1;
+            pca9685_frame_set(&frames[b], n, frame.off[b * PCA9685_CHANNELS + n]);
+        }
+    }
+}
+
+} // namespace servo_bus
+
+void Servo::init() {
+    initPWM();
+}
+
+void Servo::commit() {
+    // with the output task running this only copies the frame and the buses
+    // are written concurrently, see servo_output.h. Blocking, board by board.
+    if (!servo_bus::submit(servo_bus::staged)) {
+        servo_bus::stage(servo_bus::staged);
+        for (int b = 0; b < servo_bus::kBoards; b++)
+            ESP_ERROR_CHECK(pca9685_frame_commit(&servo_bus::boards[b], &servo_bus::frames[b]));
+    }
+    for (uint16_t& set : servo_bus::staged.set)
+        set = 0;
+}
+
+pca9685_frame_stats_t Servo::outputStats() {
+    pca9685_frame_stats_t sum = {};
+    for (int b = 0; b < servo_bus::kBoards; b++) {
+        const pca9685_frame_stats_t& s = servo_bus::frames[b].stats;
+        sum.commits += s.commits;
+        sum.skipped += s.skipped;
+        sum.transactions += s.transactions;
+        sum.bytes += s.bytes;
+        sum.channels_set += s.channels_set;
+        sum.channels_written += s.channels_written;
+    }
+    return sum;
+}
+
+void Servo::resetOutputStats() {
+    for (int b = 0; b < servo_bus::kBoards; b++)
+        servo_bus::frames[b].stats = {};
+}
+
+} // namespace hexapod
@@ -0,0 +1,44 @@
+#pragma once
+
+// Bus and boards shared by servo.cpp, servo_bus.cpp and servo_output.cpp, not
+// public API. servo.cpp only uses the staged frame and kFrequency, a port to
+// another MCU replaces servo_bus.cpp and servo_output.cpp.
+
+#include <stddef.h>
+#include <stdint.h>
+#include "pca9685.h"
+#include "servo_topology.h"
+
+namespace hexapod {
+namespace servo_bus {
+
+constexpr int kFrequency = 50;          // Servo frequency (Hz)
+constexpr int kBoards = topology::kBoardCount;
+constexpr int kChannels = topology::kChannelCount;
+
+// Off ticks by servo channel, as staged by Servo::setAngle()
+struct Frame {
+    uint16_t off[kChannels];
+    uint16_t set[kBoards];  // bit n of set[b]: channel 16*b+n was set since the last commit
+};
+
+// Channels set since the last Servo::commit() (servo.cpp)
+extern Frame staged;
+
+// frames[b] shadows what boards[b] was sent
+extern pca9685_t boards[kBoards];
+extern pca9685_frame_t frames[kBoards];
+
+// (Re)create the buses and add the boards. queueDepth > 0 puts the driver in
+// asynchronous mode, which only the output task's commits can use.
+void open(size_t queueDepth);
+void close();
+
+// Move the set channels of `frame` into the board frames (no bus access)
+void stage(const Frame& frame);
+
+// Hand `frame` to the output task, false when it is not running (servo_output.cpp)
+bool submit(const Frame& frame);
+
+} // namespace servo_bus
+} // namespace hexapod
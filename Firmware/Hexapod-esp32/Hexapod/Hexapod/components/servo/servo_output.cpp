@@ -0,0 +1,217 @@
+#include <atomic>
+#include <driver/i2c_master.h>
+#include <esp_attr.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "metrics.h"
+#include "servo_bus.h"
+#include "servo_output.h"
+
+namespace hexapod {
+
+namespace {
+
+constexpr size_t kQueueDepth = 8;               // bursts queued in the driver
+constexpr uint32_t kTaskStack = 4096;
+constexpr UBaseType_t kTaskPriority = 10;       // core 0: above motion_link (8) and httpd (5), it mostly sleeps
+constexpr BaseType_t kTaskCore = 0;             // motion runs on core 1
+
+static const char* TAG = "SERVO_OUT";
+
+// Triple buffer from Servo::commit() to the task, as in command_mailbox.c:
+// the producer fills slots[back] and swaps it with middle, the task swaps
+// front with middle when FRESH is set. Neither side ever waits.
+constexpr uint32_t FRESH = 0x4u;
+constexpr uint32_t INDEX = 0x3u;
+
+struct Slot {
+    servo_bus::Frame frame;                 // whole staged frame, set = this commit's channels
+    uint16_t known[servo_bus::kBoards];     // every channel ever set, for skipped commits
+    uint32_t seq;                           // submitted count at this commit
+    int64_t commitUs;
+};
+
+Slot slots[3];
+std::atomic<uint32_t> middle{1};
+uint32_t back = 0;                          // Servo::commit() only
+uint32_t front = 2;                         // task only
+uint16_t known[servo_bus::kBoards];         // Servo::commit() only
+
+SemaphoreHandle_t frameReady;   // commit -> task
+SemaphoreHandle_t transferDone; // completion callback -> task, one per burst
+SemaphoreHandle_t frameWritten; // task -> flush()
+SemaphoreHandle_t taskExited;   // task -> stop()
+
+std::atomic<bool> isRunning{false};
+std::atomic<bool> stopping{false};
+std::atomic<bool> transferFailed{false};
+
+std::atomic<uint32_t> submitted{0};
+std::atomic<uint32_t> merged{0};
+std::atomic<uint32_t> written{0};
+std::atomic<uint32_t> completed{0};     // commits whose frame is on the wire
+std::atomic<uint32_t> errors{0};
+
+// Called from the I2C ISR once per burst
+bool IRAM_ATTR onTransDone(i2c_master_dev_handle_t, const i2c_master_event_data_t* evt, void*) {
+    if (evt->event != I2C_EVENT_DONE)
+        transferFailed = true;
+
+    BaseType_t woken = pdFALSE;
+    xSemaphoreGiveFromISR(transferDone, &woken);
+    return woken == pdTRUE;
+}
+
+void outputTask(void*) {
+    for (;;) {
+        xSemaphoreTake(frameReady, portMAX_DELAY);
+        if (stopping)
+            break;
+
+        if (!(middle.load(std::memory_order_relaxed) & FRESH))
+            continue;
+        front = middle.exchange(front, std::memory_order_acq_rel) & INDEX;
+        const Slot& slot = slots[front];
+
+        // commits the task never saw were replaced by this one: their channels
+        // are among the known ones, the board shadows skip the unchanged
+        servo_bus::Frame frame = slot.frame;
+        uint32_t skipped = slot.seq - completed - 1;
+        if (skipped) {
+            merged += skipped;
+            for (int b = 0; b < servo_bus::kBoards; b++)
+                frame.set[b] = slot.known[b];
+        }
+        servo_bus::stage(frame);
+
+        // queue every board before waiting: each bus runs its own queue, so
+        // boards on different buses transfer at the same time. The bursts live
+        // in frames[b].tx, not touched again until every completion is in.
+        bool failed = false;
+        uint32_t queued = 0;
+        for (int b = 0; b < servo_bus::kBoards; b++) {
+            uint32_t before = servo_bus::frames[b].stats.transactions;
+            if (pca9685_frame_commit(&servo_bus::boards[b], &servo_bus::frames[b]) != ESP_OK)
+                failed = true;
+            queued += servo_bus::frames[b].stats.transactions - before;
+        }
+        for (uint32_t i = 0; i < queued; i++)
+            xSemaphoreTake(transferDone, portMAX_DELAY);
+
+        if (transferFailed.exchange(false))
+            failed = true;
+        if (failed) {
+            // the boards may hold anything now, rewrite all channels next frame
+            ESP_LOGW(TAG, "servo frame write failed");
+            errors++;
+            for (int b = 0; b < servo_bus::kBoards; b++)
+                pca9685_frame_invalidate(&servo_bus::frames[b]);
+        }
+
+        metrics::record(metrics::SERVO_WRITE, (uint32_t)(esp_timer_get_time() - slot.commitUs));
+        written++;
+        completed = slot.seq;
+        xSemaphoreGive(frameWritten);
+    }
+
+    xSemaphoreGive(taskExited);
+    vTaskDelete(NULL);
+}
+
+} // namespace
+
+namespace servo_bus {
+
+bool submit(const Frame& frame) {
+    if (!isRunning)
+        return false;
+
+    Slot& slot = slots[back];
+    slot.frame = frame;
+    for (int b = 0; b < kBoards; b++) {
+        known[b] |= frame.set[b];
+        slot.known[b] = known[b];
+    }
+    slot.seq = ++submitted;
+    slot.commitUs = esp_timer_get_time();
+    back = middle.exchange(back | FRESH, std::memory_order_acq_rel) & INDEX;
+    xSemaphoreGive(frameReady);
+    return true;
+}
+
+} // namespace servo_bus
+
+void ServoOutput::start() {
+    if (isRunning)
+        return;
+
+    frameReady = xSemaphoreCreateBinary();
+    transferDone = xSemaphoreCreateCounting(servo_bus::kChannels, 0);
+    frameWritten = xSemaphoreCreateBinary();
+    taskExited = xSemaphoreCreateBinary();
+
+    // the driver picks asynchronous mode when a bus is created, the boards
+    // keep their registers and frames their shadow across the reopen
+    servo_bus::close();
+    servo_bus::open(kQueueDepth);
+
+    i2c_master_event_callbacks_t cbs = {};
+    cbs.on_trans_done = onTransDone;
+    for (int b = 0; b < servo_bus::kBoards; b++)
+        ESP_ERROR_CHECK(i2c_master_register_event_callbacks(servo_bus::boards[b].device_handle, &cbs, nullptr));
+
+    back = 0;
+    middle = 1;
+    front = 2;
+    completed = submitted.load();
+    stopping = false;
+    isRunning = true;
+    if (xTaskCreatePinnedToCore(outputTask, "servo_output", kTaskStack, nullptr, kTaskPriority, nullptr, kTaskCore) != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create servo output task");
+        isRunning = false;
+        servo_bus::close();
+        servo_bus::open(0);
+
+        vSemaphoreDelete(frameReady);
+        vSemaphoreDelete(transferDone);
+        vSemaphoreDelete(frameWritten);
+        vSemaphoreDelete(taskExited);
+    }
+}
+
+void ServoOutput::stop() {
+    if (!isRunning)
+        return;
+
+    flush();
+    isRunning = false;
+    stopping = true;
+    xSemaphoreGive(frameReady);
+    xSemaphoreTake(taskExited, portMAX_DELAY);
+
+    servo_bus::close();
+    servo_bus::open(0);
+
+    vSemaphoreDelete(frameReady);
+    vSemaphoreDelete(transferDone);
+    vSemaphoreDelete(frameWritten);
+    vSemaphoreDelete(taskExited);
+}
+
+bool ServoOutput::running() {
+    return isRunning;
+}
+
+void ServoOutput::flush() {
+    while (isRunning && completed < submitted)
+        xSemaphoreTake(frameWritten, pdMS_TO_TICKS(100));
+}
+
+ServoOutput::Stats ServoOutput::stats() {
+    return Stats{submitted, merged, written, errors};
+}
+
+} // namespace hexapod
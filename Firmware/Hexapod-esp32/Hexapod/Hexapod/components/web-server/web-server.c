@@ -19,6 +19,8 @@
 // Include your custom headers
 #include "connect_wifi.h"
 #include "web-server.h"
+#include "command_mailbox.h"
+#include "hexapod_metrics.h"
 #include "led_strip.h"
 
 // --- LED CONFIG (Kept from your original code) ---
@@ -128,6 +130,34 @@ static esp_err_t calibration_req_handler(httpd_req_t *req)
     return ESP_OK;
 }
 
+// ---------------------------------------------------------
+// HTTP GET handler for "/metrics" (Prometheus text)
+// ---------------------------------------------------------
+static esp_err_t metrics_req_handler(httpd_req_t *req)
+{
+    // every handler runs in the httpd task, one buffer is enough
+    static char block[2048];
+    size_t len;
+
+    httpd_resp_set_type(req, "text/plain; version=0.0.4");
+    for (int i = 0; (len = hexapod_metrics_format(i, block, sizeof(block))); i++) {
+        if (httpd_resp_send_chunk(req, block, len) != ESP_OK)
+            return ESP_FAIL;
+    }
+    return httpd_resp_send_chunk(req, NULL, 0);
+}
+
+// ---------------------------------------------------------
+// HTTP POST handler for "/metrics/reset"
+// ---------------------------------------------------------
+static esp_err_t metrics_reset_handler(httpd_req_t *req)
+{
+    hexapod_metrics_reset();
+    ESP_LOGI(TAG, "Metrics reset");
+    httpd_resp_send(req, "ok\n", HTTPD_RESP_USE_STRLEN);
+    return ESP_OK;
+}
+
 // ---------------------------------------------------------
 // WebSocket handler for "/cmd"
 // ---------------------------------------------------------
@@ -175,8 +205,9 @@ static esp_err_t cmd_ws_handler(httpd_req_t *req)
                 }
                 led_strip_refresh(strip);
 
-                // TODO: Insert your robot motor control logic here based on 'cmd'
-                // 1=Forward, 2=Run, 3=Back, 4=Left, 5=Right, etc.
+                // The page sends 1 << MovementMode: 1=Standby, 2=Forward, 4=Run, 8=Back, etc.
+                if (cmd > 0)
+                    command_mailbox_set_mode((uint8_t)__builtin_ctz(cmd));
             }
 
             // 2. Check for Speed Command
@@ -184,22 +215,48 @@ static esp_err_t cmd_ws_handler(httpd_req_t *req)
             if (speed) {
                 double spd = speed->valuedouble;
                 ESP_LOGI(TAG, "Speed Set: %.2f", spd);
-                // TODO: Update robot global speed variable here
+                command_mailbox_set_speed((float)spd);
             }
+
+            // Body pose: [roll, pitch, yaw, x, y, z] in degrees and mm
+            cJSON *pose = cJSON_GetObjectItem(root, "pose");
+            if (cJSON_IsArray(pose) && cJSON_GetArraySize(pose) == 6) {
+                float p[6];
+                for (int i = 0; i < 6; i++)
+                    p[i] = (float)cJSON_GetArrayItem(pose, i)->valuedouble;
+                command_mailbox_set_pose(p);
+            }
+
             // 3. Check for CALIBRATION COMMANDS
             cJSON *cal = cJSON_GetObjectItem(root, "cal_action");
-            if (cal) {
+            if (cJSON_IsString(cal)) {
                 char *action = cal->valuestring; // It's a string like "save" or "start"
                 ESP_LOGI(TAG, "Calibration Action: %s", action);
 
+                // applied in order by the motion task, a full queue drops them
+                command_action_t a = {0};
                 if (strcmp(action, "save") == 0) {
                     ESP_LOGI(TAG, "Saving calibration to NVS...");
-                    // Call your save function here
+                    a.type = COMMAND_CAL_SAVE;
                 } 
                 else if (strcmp(action, "start") == 0) {
                     ESP_LOGI(TAG, "Starting calibration routine...");
-                    // Call your calibration start function here
+                    a.type = COMMAND_CAL_START;
                 }
+                else if (strcmp(action, "offset") == 0) {
+                    // {"cal_action": "offset", "leg": 5, "part": 0, "val": 10}
+                    cJSON *leg = cJSON_GetObjectItem(root, "leg");
+                    cJSON *part = cJSON_GetObjectItem(root, "part");
+                    cJSON *val = cJSON_GetObjectItem(root, "val");
+                    if (leg && part && val) {
+                        a.type = COMMAND_CAL_OFFSET;
+                        a.leg = (int8_t)leg->valueint;
+                        a.part = (int8_t)part->valueint;
+                        a.value = (int16_t)val->valueint;
+                    }
+                }
+                if (a.type && !command_mailbox_push(a))
+                    ESP_LOGW(TAG, "Calibration queue full, %s dropped", action);
             }
 
             cJSON_Delete(root);
@@ -233,6 +290,8 @@ static httpd_handle_t setup_websocket_server(void)
     
     // Increase URI match length slightly if needed, default is usually fine
     config.max_uri_handlers = 12; 
+    // core 1 belongs to the motion task
+    config.core_id = 0;
 
     // URI: / (Index)
     httpd_uri_t uri_get = {
@@ -259,10 +318,27 @@ static httpd_handle_t setup_websocket_server(void)
         .is_websocket = true
     };
 
+    // URI: /metrics, and a POST to /metrics/reset to empty the histograms
+    httpd_uri_t uri_metrics = {
+        .uri = "/metrics",
+        .method = HTTP_GET,
+        .handler = metrics_req_handler,
+        .user_ctx = NULL
+    };
+
+    httpd_uri_t uri_metrics_reset = {
+        .uri = "/metrics/reset",
+        .method = HTTP_POST,
+        .handler = metrics_reset_handler,
+        .user_ctx = NULL
+    };
+
     if (httpd_start(&server, &config) == ESP_OK) {
         httpd_register_uri_handler(server, &uri_get);
         httpd_register_uri_handler(server, &uri_cal);
         httpd_register_uri_handler(server, &uri_ws);
+        httpd_register_uri_handler(server, &uri_metrics);
+        httpd_register_uri_handler(server, &uri_metrics_reset);
         ESP_LOGI(TAG, "Server started on port 80");
     }
 
@@ -0,0 +1,1440 @@
+// Host microbenchmarks for the motion hot path.
+//
+// Reports ns/op (mean, stddev, min over --reps batches) for the kinematics,
+// Movement::next on every MovementMode table, the servo angle-to-tick
+// conversion and a full frame through the mock I2C bus. With --accuracy the
+// IK kernels are also checked by IK -> FK round trips over the same inputs.
+// The web server's commands are checked through Hexapod::processCommands on
+// every run; a failed check makes the exit status 1.
+//
+// Host numbers are not ESP32-S3 numbers, use them to compare changes.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "body_kinematics.h"
+#include "command_mailbox.h"
+#include "config.h"
+#include "esp_timer.h"
+#include "event_log.h"
+#include "fast_math.h"
+#include "hexapod.h"
+#include "hexapod_metrics.h"
+#include "i2c_mock.h"
+#include "leg.h"
+#include "metrics.h"
+#include "motion_counters.h"
+#include "motion_frame.h"
+#include "motion_task.h"
+#include "movement.h"
+#include "nvs.h"
+#include "reachability.h"
+#include "servo.h"
+#include "servo_output.h"
+
+using namespace hexapod;
+
+namespace {
+
+    const char* const kModeNames[MOVEMENT_TOTAL] = {
+        "standby", "forward", "forwardfast", "backward", "turnleft", "turnright", "shiftleft",
+        "shiftright", "climb", "rotatex", "rotatey", "rotatez", "twist",
+    };
+
+    // frames sampled per mode, two full cycles of the 20 keyframe tables
+    const int kFramesPerMode = 40;
+
+    struct Options {
+        int reps = 15;
+        bool accuracy = false;
+        const char* filter = nullptr;
+    };
+
+    struct Stats {
+        double mean;
+        double stddev;
+        double min;
+    };
+
+    struct Sample {
+        int leg;
+        Point3D local;
+    };
+
+    volatile float g_sink;
+
+    using Clock = std::chrono::steady_clock;
+
+    // Run `batch` (which performs `ops` operations) once to warm up, then
+    // `reps` times, and return per-operation statistics in nanoseconds.
+    Stats measure(const std::function<void()>& batch, int ops, int reps) {
+        batch();
+
+        std::vector<double> samples;
+        for (int r = 0; r < reps; r++) {
+            auto start = Clock::now();
+            batch();
+            auto stop = Clock::now();
+            samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count() / ops);
+        }
+
+        double sum = 0;
+        for (double s : samples) sum += s;
+        double mean = sum / samples.size();
+
+        double var = 0;
+        for (double s : samples) var += (s - mean) * (s - mean);
+        var /= samples.size() > 1 ? samples.size() - 1 : 1;
+
+        return {mean, std::sqrt(var), *std::min_element(samples.begin(), samples.end())};
+    }
+
+    bool selected(const Options& opt, const char* name) {
+        return !opt.filter || std::strstr(name, opt.filter);
+    }
+
+    void report(const char* name, const Stats& s) {
+        std::printf("%-36s %10.1f %10.1f %10.1f\n", name, s.mean, s.stddev, s.min);
+    }
+
+    // World frames of every mode over two gait cycles (with the mode's body
+    // pose applied), sampled after the mode switch transition has settled
+    std::vector<Locations> collectFrames() {
+        std::vector<Locations> frames;
+        for (MovementMode mode = MOVEMENT_STANDBY; mode < MOVEMENT_TOTAL; mode++) {
+            Movement movement(MOVEMENT_STANDBY);
+            movement.setMode(mode);
+            for (int f = 0; f < kFramesPerMode; f++)
+                movement.next(config::movementIntervalUs);
+            for (int f = 0; f < kFramesPerMode; f++) {
+                const Locations& location = movement.next(config::movementIntervalUs);
+                frames.push_back(PoseTransform(movement.pose()).apply(location));
+            }
+        }
+        return frames;
+    }
+
+    // Leg-local IK inputs: every leg tip of every frame
+    std::vector<Sample> collectSamples(Leg* legs[6], const std::vector<Locations>& frames) {
+        std::vector<Sample> samples;
+        for (const Locations& frame : frames) {
+            for (int i = 0; i < 6; i++) {
+                Sample s;
+                s.leg = i;
+                legs[i]->translateToLocal(frame.get(i), s.local);
+                samples.push_back(s);
+            }
+        }
+        return samples;
+    }
+
+    // World -> local mount transform as Leg did it before leg_geometry.h: a
+    // function pointer per leg with double 0.7071 terms. Reference only.
+    namespace legacy {
+
+        void rotate0(const Point3D& src, Point3D& dest) {
+            dest = src;
+        }
+
+        void rotate45(const Point3D& src, Point3D& dest) {
+            dest.x_ = src.x_ * 0.7071 - src.y_ * 0.7071;
+            dest.y_ = src.x_ * 0.7071 + src.y_ * 0.7071;
+            dest.z_ = src.z_;
+        }
+
+        void rotate135(const Point3D& src, Point3D& dest) {
+            dest.x_ = src.x_ * (-0.7071) - src.y_ * 0.7071;
+            dest.y_ = src.x_ * 0.7071 + src.y_ * (-0.7071);
+            dest.z_ = src.z_;
+        }
+
+        void rotate180(const Point3D& src, Point3D& dest) {
+            dest.x_ = -src.x_;
+            dest.y_ = -src.y_;
+            dest.z_ = src.z_;
+        }
+
+        void rotate225(const Point3D& src, Point3D& dest) {
+            dest.x_ = src.x_ * (-0.7071) - src.y_ * (-0.7071);
+            dest.y_ = src.x_ * (-0.7071) + src.y_ * (-0.7071);
+            dest.z_ = src.z_;
+        }
+
+        void rotate315(const Point3D& src, Point3D& dest) {
+            dest.x_ = src.x_ * 0.7071 - src.y_ * (-0.7071);
+            dest.y_ = src.x_ * (-0.7071) + src.y_ * 0.7071;
+            dest.z_ = src.z_;
+        }
+
+        struct Mount {
+            Point3D position;
+            void (*localConv)(const Point3D& src, Point3D& dest);
+        };
+
+        const Mount kMounts[6] = {
+            {{config::kLegMountOtherX, config::kLegMountOtherY, 0}, rotate315},
+            {{config::kLegMountLeftRightX, 0, 0}, rotate0},
+            {{config::kLegMountOtherX, -config::kLegMountOtherY, 0}, rotate45},
+            {{-config::kLegMountOtherX, -config::kLegMountOtherY, 0}, rotate135},
+            {{-config::kLegMountLeftRightX, 0, 0}, rotate180},
+            {{-config::kLegMountOtherX, config::kLegMountOtherY, 0}, rotate225},
+        };
+
+        void translateToLocal(int leg, const Point3D& world, Point3D& local) {
+            kMounts[leg].localConv(world - kMounts[leg].position, local);
+        }
+    }
+
+    // IK kernels under test, all with the Leg::_inverseKinematics signature
+    struct IkKernel {
+        const char* name;
+        void (*solve)(const Point3D& to, float angles[3]);
+    };
+
+    const IkKernel kIkKernels[] = {
+        {"Leg::_inverseKinematicsLibm", Leg::_inverseKinematicsLibm},
+        {"Leg::_inverseKinematicsFast", Leg::_inverseKinematicsFast},
+    };
+
+    void benchKinematics(const Options& opt, const std::vector<Sample>& samples) {
+        const int n = samples.size();
+
+        for (const IkKernel& kernel : kIkKernels) {
+            if (!selected(opt, kernel.name))
+                continue;
+            report(kernel.name, measure([&] {
+                float angles[3];
+                float acc = 0;
+                for (const Sample& s : samples) {
+                    kernel.solve(s.local, angles);
+                    acc += angles[0] + angles[1] + angles[2];
+                }
+                g_sink = acc;
+            }, n, opt.reps));
+        }
+
+        if (selected(opt, "Leg::_forwardKinematics")) {
+            std::vector<float> angles(n * 3);
+            for (int i = 0; i < n; i++)
+                Leg::_inverseKinematics(samples[i].local, &angles[i * 3]);
+
+            report("Leg::_forwardKinematics", measure([&] {
+                Point3D out;
+                float acc = 0;
+                for (int i = 0; i < n; i++) {
+                    Leg::_forwardKinematics(&angles[i * 3], out);
+                    acc += out.x_ + out.y_ + out.z_;
+                }
+                g_sink = acc;
+            }, n, opt.reps));
+        }
+    }
+
+    // Whole body solve against the per-leg path HexapodClass used before, per frame
+    void benchBody(const Options& opt, Leg* legs[6], const std::vector<Locations>& frames) {
+        const int n = frames.size();
+
+        if (selected(opt, "BodyKinematics::solve")) {
+            report("BodyKinematics::solve", measure([&] {
+                JointAngles angles;
+                float acc = 0;
+                for (const Locations& frame : frames) {
+                    BodyKinematics::solve(frame, angles);
+                    acc += angles.angles[0][1] + angles.angles[5][2];
+                }
+                g_sink = acc;
+            }, n, opt.reps));
+        }
+
+        if (selected(opt, "6x Leg local+IK")) {
+            report("6x Leg local+IK", measure([&] {
+                float angles[3];
+                float acc = 0;
+                for (const Locations& frame : frames) {
+                    for (int i = 0; i < 6; i++) {
+                        Point3D local;
+                        legs[i]->translateToLocal(frame.get(i), local);
+                        Leg::_inverseKinematics(local, angles);
+                        acc += angles[1];
+                    }
+                }
+                g_sink = acc;
+            }, n, opt.reps));
+        }
+
+        // mount transform alone, per leg point
+        if (selected(opt, "Leg::translateToLocal")) {
+            report("Leg::translateToLocal", measure([&] {
+                float acc = 0;
+                for (const Locations& frame : frames) {
+                    for (int i = 0; i < 6; i++) {
+                        Point3D local;
+                        legs[i]->translateToLocal(frame.get(i), local);
+                        acc += local.x_ + local.y_;
+                    }
+                }
+                g_sink = acc;
+            }, n * 6, opt.reps));
+        }
+
+        if (selected(opt, "legacy translateToLocal (fn ptr)")) {
+            report("legacy translateToLocal (fn ptr)", measure([&] {
+                float acc = 0;
+                for (const Locations& frame : frames) {
+                    for (int i = 0; i < 6; i++) {
+                        Point3D local;
+                        legacy::translateToLocal(i, frame.get(i), local);
+                        acc += local.x_ + local.y_;
+                    }
+                }
+                g_sink = acc;
+            }, n * 6, opt.reps));
+        }
+    }
+
+    // Random leg local points in a box around the workspace, about half unreachable
+    std::vector<Point3D> randomLocalPoints(int n) {
+        std::vector<Point3D> points;
+        std::srand(1);
+        auto uniform = [](float lo, float hi) { return lo + (hi - lo) * std::rand() / (float)RAND_MAX; };
+        for (int i = 0; i < n; i++)
+            points.emplace_back(uniform(-40, 200), uniform(-160, 160), uniform(-140, 120));
+        return points;
+    }
+
+    void benchReach(const Options& opt, const std::vector<Sample>& samples) {
+        if (selected(opt, "reachability::reachable(gait)")) {
+            report("reachability::reachable(gait)", measure([&] {
+                int acc = 0;
+                for (const Sample& s : samples)
+                    acc += reachability::reachable(s.local.x_, s.local.y_, s.local.z_);
+                g_sink = acc;
+            }, samples.size(), opt.reps));
+        }
+
+        if (selected(opt, "reachability::reachable(random)")) {
+            std::vector<Point3D> points = randomLocalPoints(4096);
+            report("reachability::reachable(random)", measure([&] {
+                int acc = 0;
+                for (const Point3D& p : points)
+                    acc += reachability::reachable(p.x_, p.y_, p.z_);
+                g_sink = acc;
+            }, points.size(), opt.reps));
+        }
+    }
+
+    void benchMovement(const Options& opt) {
+        const int kOps = 2000;
+        char name[64];
+
+        for (MovementMode mode = MOVEMENT_STANDBY; mode < MOVEMENT_TOTAL; mode++) {
+            std::snprintf(name, sizeof(name), "Movement::next(%s)", kModeNames[mode]);
+            if (!selected(opt, name))
+                continue;
+
+            Movement movement(MOVEMENT_STANDBY);
+            movement.setMode(mode);
+            report(name, measure([&] {
+                float acc = 0;
+                for (int i = 0; i < kOps; i++)
+                    acc += movement.next(config::movementIntervalUs).get(0).z_;
+                g_sink = acc;
+            }, kOps, opt.reps));
+        }
+    }
+
+    void benchGait(const Options& opt) {
+        const int kOps = 2000;
+        const char* const names[GAIT_TOTAL] = {"tripod", "ripple", "wave"};
+        char name[64];
+
+        for (int pattern = GAIT_TRIPOD; pattern < GAIT_TOTAL; pattern++) {
+            std::snprintf(name, sizeof(name), "GaitGenerator::next(%s)", names[pattern]);
+            if (!selected(opt, name))
+                continue;
+
+            GaitGenerator gait;
+            gait.setParams({40, 80, 15, 25, 50, (GaitPattern)pattern});
+            report(name, measure([&] {
+                float acc = 0;
+                for (int i = 0; i < kOps; i++)
+                    acc += gait.next(config::movementIntervalUs, config::defaultSpeed).get(0).z_;
+                g_sink = acc;
+            }, kOps, opt.reps));
+        }
+    }
+
+    // Per frame body pose cost in HexapodClass::processMovement: two poses
+    // composed into one transform, applied to the six tips
+    void benchPose(const Options& opt, const std::vector<Locations>& frames) {
+        const char* name = "PoseTransform compose+apply";
+        if (!selected(opt, name))
+            return;
+
+        BodyPose user {2.0f, -3.0f, 5.0f, 4.0f, -2.0f, 6.0f};
+        BodyPose gait {-1.0f, 1.5f, 0.0f, 0.0f, 3.0f, 0.0f};
+        report(name, measure([&] {
+            float acc = 0;
+            for (const Locations& frame : frames) {
+                gait.roll += 1e-3f;
+                Locations posed = (PoseTransform(user) * PoseTransform(gait)).apply(frame);
+                acc += posed.get(0).x_ + posed.get(5).z_;
+            }
+            g_sink = acc;
+        }, frames.size(), opt.reps));
+    }
+
+    // Hot path cost of a log call: EVENT_LOG only stores the raw arguments,
+    // the old path formatted on the spot (snprintf, before the UART write).
+    // Records are drained between batches and the drain is timed on its own.
+    void benchLog(const Options& opt) {
+        const int kBatch = 48;      // below the ring depth, nothing is dropped
+
+        if (selected(opt, "EVENT_LOG record")) {
+            std::vector<double> recordNs, drainNs;
+            for (int r = 0; r < opt.reps + 1; r++) {
+                auto start = Clock::now();
+                for (int i = 0; i < kBatch; i++)
+                    EVENT_LOG(SPEED_SET, 0.5f + i, config::minSpeed, config::maxSpeed);
+                auto mid = Clock::now();
+                event_log::drain();
+                auto stop = Clock::now();
+                if (r == 0)
+                    continue;
+                recordNs.push_back(std::chrono::duration<double, std::nano>(mid - start).count() / kBatch);
+                drainNs.push_back(std::chrono::duration<double, std::nano>(stop - mid).count() / kBatch);
+            }
+            auto stats = [](const std::vector<double>& v) {
+                double mean = 0, var = 0;
+                for (double x : v) mean += x;
+                mean /= v.size();
+                for (double x : v) var += (x - mean) * (x - mean);
+                var /= v.size() > 1 ? v.size() - 1 : 1;
+                return Stats{mean, std::sqrt(var), *std::min_element(v.begin(), v.end())};
+            };
+            report("EVENT_LOG record", stats(recordNs));
+            report("event_log::drain (per record)", stats(drainNs));
+        }
+
+        if (selected(opt, "snprintf (old log path)")) {
+            char buffer[100];
+            report("snprintf (old log path)", measure([&] {
+                for (int i = 0; i < kBatch; i++) {
+                    snprintf(buffer, sizeof(buffer), "运动速度已设置为: %.2f (范围: %.1f - %.1f)",
+                             0.5f + i, config::minSpeed, config::maxSpeed);
+                    g_sink = buffer[i % 8];
+                }
+            }, kBatch, opt.reps));
+        }
+
+        if (selected(opt, "EVENT_LOG rate limited")) {
+            // a clipped joint every frame: one record per interval, the rest counted
+            report("EVENT_LOG rate limited", measure([&] {
+                for (int i = 0; i < kBatch; i++)
+                    EVENT_LOG(SERVO_ANGLE_MAX, 1, 95.0f);
+            }, kBatch, opt.reps));
+            event_log::drain();
+        }
+
+        event_log::Stats s = event_log::stats();
+        std::printf("\n  event log: %u recorded, %u printed, %u suppressed, %u dropped\n",
+            s.recorded, s.printed, s.suppressed, s.dropped);
+    }
+
+    void benchServo(const Options& opt, Leg* legs[6], const std::vector<Sample>& samples) {
+        if (selected(opt, "Servo::angleToTicks")) {
+            std::vector<float> angles;
+            for (const Sample& s : samples) {
+                float a[3];
+                Leg::_inverseKinematics(s.local, a);
+                angles.insert(angles.end(), a, a + 3);
+            }
+
+            Servo servo(0, 0);
+            report("Servo::angleToTicks", measure([&] {
+                int acc = 0;
+                for (float a : angles)
+                    acc += servo.angleToTicks(a);
+                g_sink = acc;
+            }, angles.size(), opt.reps));
+        }
+
+        if (selected(opt, "Leg::moveTip (mock bus)")) {
+            // each leg replays its own tip path, repeated targets hit the moveTip() cache as on the robot
+            std::vector<Point3D> world(samples.size());
+            for (size_t i = 0; i < samples.size(); i++)
+                legs[samples[i].leg]->translateToWorld(samples[i].local, world[i]);
+
+            report("Leg::moveTip (mock bus)", measure([&] {
+                for (size_t i = 0; i < samples.size(); i++)
+                    legs[samples[i].leg]->moveTip(world[i]);
+                Servo::commit();
+            }, samples.size(), opt.reps));
+        }
+    }
+
+    // One control frame as HexapodClass::processMovement runs it: next(), table
+    // angles or body IK, six moveTipSolved(). playback=false always solves.
+    void benchFrame(const Options& opt, Leg* legs[6], bool playback) {
+        const char* name = playback ? "frame(forward) compute+mock bus" : "frame(forward) IK every frame";
+        if (!selected(opt, name))
+            return;
+
+        const int kFrames = 500;
+        Movement movement(MOVEMENT_STANDBY);
+        movement.setMode(MOVEMENT_FORWARD);
+
+        auto frame = [&] {
+            const Locations& location = movement.next(config::movementIntervalUs);
+            JointAngles solved;
+            const JointAngles* angles = playback ? movement.angles() : nullptr;
+            if (!angles) {
+                BodyKinematics::solve(location, solved);
+                angles = &solved;
+            }
+            for (int i = 0; i < 6; i++)
+                legs[i]->moveTipSolved(location.get(i), angles->angles[i]);
+            Servo::commit();
+        };
+
+        Stats s = measure([&] {
+            for (int f = 0; f < kFrames; f++)
+                frame();
+        }, kFrames, opt.reps);
+        report(name, s);
+        if (!playback)
+            return;
+
+        std::printf("\n  compute is %.3f%% of the %d ms movementInterval (host)\n",
+            s.mean / (config::movementInterval * 1e4), config::movementInterval);
+    }
+
+    // Servo output per control frame, every mode entered from standby. The
+    // baseline is one 6 byte transaction per joint set, as before frame commits.
+    void reportBusTraffic(const Options& opt, Leg* legs[6]) {
+        if (!selected(opt, "bus traffic"))
+            return;
+
+        std::printf("\n%-16s %8s %8s %8s %8s %10s %10s\n",
+            "bus per frame", "sets", "tx", "bytes", "skipped", "tx saved", "bytes saved");
+
+        for (MovementMode mode = MOVEMENT_STANDBY; mode < MOVEMENT_TOTAL; mode++) {
+            Movement movement(MOVEMENT_STANDBY);
+            movement.setMode(mode);
+
+            i2c_mock_stats_t bus;
+            i2c_mock_reset_stats();
+            Servo::resetOutputStats();
+            const int kFrames = 200;
+            for (int f = 0; f < kFrames; f++) {
+                Locations location = movement.next(config::movementIntervalUs);
+                bool hasPose = !movement.pose().isIdentity();
+                if (hasPose)
+                    location = PoseTransform(movement.pose()).apply(location);
+                JointAngles solved;
+                const JointAngles* angles = hasPose ? nullptr : movement.angles();
+                if (!angles) {
+                    BodyKinematics::solve(location, solved);
+                    angles = &solved;
+                }
+                for (int i = 0; i < 6; i++)
+                    legs[i]->moveTipSolved(location.get(i), angles->angles[i]);
+                Servo::commit();
+            }
+            i2c_mock_get_stats(&bus);
+            pca9685_frame_stats_t out = Servo::outputStats();
+
+            std::printf("%-16s %8.1f %8.2f %8.1f %7.0f%% %9.0f%% %9.0f%%\n", kModeNames[mode],
+                (double)out.channels_set / kFrames, (double)bus.transactions / kFrames,
+                (double)bus.bytes / kFrames, 50.0 * out.skipped / kFrames,
+                100.0 - 100.0 * out.transactions / (kFrames * 18.0),
+                100.0 - 100.0 * out.bytes / (kFrames * 18.0 * 6));
+        }
+    }
+
+    // The runtime gait generator walking what the straight tables walk: a
+    // 50 mm tripod stride with 25 mm steps. Largest tip distance between the
+    // two over two cycles, at the best phase alignment.
+    void reportGaitGenerator(const Options& opt) {
+        if (!selected(opt, "gait generator"))
+            return;
+
+        // 50 mm of stance in half a 400 ms cycle at speed 1
+        const float v = 50 / 0.2f * config::defaultSpeed;
+        const struct {
+            MovementMode mode;
+            float vx, vy;
+        } kCases[] = {
+            {MOVEMENT_FORWARD, 0, v}, {MOVEMENT_BACKWARD, 0, -v},
+            {MOVEMENT_SHIFTLEFT, -v, 0}, {MOVEMENT_SHIFTRIGHT, v, 0},
+        };
+        const int kSettle = 100;
+        const int kFrames = 40;
+
+        std::printf("\n%-16s %10s\n", "gait generator", "table mm");
+
+        for (const auto& c : kCases) {
+            std::vector<Locations> paths[2];
+            for (int g = 0; g < 2; g++) {
+                Movement movement(MOVEMENT_STANDBY);
+                std::srand(1);
+                if (g)
+                    movement.setGait({c.vx, c.vy, 0, 25, 50, GAIT_TRIPOD});
+                else
+                    movement.setMode(c.mode);
+                for (int f = 0; f < kSettle + kFrames; f++) {
+                    const Locations& location = movement.next(config::movementIntervalUs);
+                    if (f >= kSettle)
+                        paths[g].push_back(location);
+                }
+            }
+
+            float best = 1e9f;
+            for (int shift = 0; shift < kFrames; shift++) {
+                float worst = 0;
+                for (int f = 0; f < kFrames; f++)
+                    for (int leg = 0; leg < 6; leg++) {
+                        Point3D d = paths[1][(f + shift) % kFrames].get(leg) - paths[0][f].get(leg);
+                        worst = std::max(worst, std::sqrt(d.x_*d.x_ + d.y_*d.y_ + d.z_*d.z_));
+                    }
+                best = std::min(best, worst);
+            }
+            std::printf("%-16s %10.2f\n", kModeNames[c.mode], best);
+        }
+    }
+
+    // Switching from the forward gait to every location table, once at each
+    // frame of a forward cycle: frames until the new table runs (mean, max)
+    // and the longest a foot was dragged, moved while down on the ground.
+    void reportModeSwitch(const Options& opt) {
+        if (!selected(opt, "mode switch"))
+            return;
+
+        const int kCycle = 40;  // frames of a forward cycle at the default speed
+
+        std::printf("\n%-16s %10s %10s %10s\n", "mode switch", "frames", "max", "drag mm");
+
+        for (MovementMode mode = MOVEMENT_STANDBY; mode < MOVEMENT_TOTAL; mode++) {
+            if (mode == MOVEMENT_FORWARD || mode >= MOVEMENT_ROTATEX)
+                continue;
+
+            int total = 0, longest = 0;
+            float drag = 0;
+            for (int at = 0; at < kCycle; at++) {
+                Movement movement(MOVEMENT_STANDBY);
+                movement.setMode(MOVEMENT_FORWARD);
+                for (int f = 0; f < kCycle + at; f++)
+                    movement.next(config::movementIntervalUs);
+
+                std::vector<Locations> frames{movement.next(config::movementIntervalUs)};
+                movement.setMode(mode);
+                while (movement.transiting() && frames.size() < 100)
+                    frames.push_back(movement.next(config::movementIntervalUs));
+                total += frames.size() - 1;
+                longest = std::max(longest, (int)frames.size() - 1);
+
+                for (int i = 0; i < 6; i++) {
+                    float ground = 0;
+                    for (const Locations& l : frames)
+                        ground = std::min(ground, l.get(i).z_);
+                    float dragged = 0;
+                    for (size_t f = 1; f < frames.size(); f++) {
+                        const Point3D& a = frames[f - 1].get(i);
+                        const Point3D& b = frames[f].get(i);
+                        if (a.z_ < ground + 0.5f && b.z_ < ground + 0.5f)
+                            dragged += std::hypot(b.x_ - a.x_, b.y_ - a.y_);
+                    }
+                    drag = std::max(drag, dragged);
+                }
+            }
+            std::printf("%-16s %10.1f %10d %10.1f\n", kModeNames[mode], (double)total / kCycle, longest, drag);
+        }
+    }
+
+    // The gait clock at other control rates: every mode entered from standby
+    // at a speed the old ms clock had to round, sampled at instants all rates
+    // share. A frame within half a frame of a keyframe lands on it and the
+    // gait starts on its entry keyframe after the switch, both by up to a
+    // frame of the rate, so the paths differ by a few mm of foot travel.
+    // "on key" is the share of 50 Hz frames played from pre-solved joints.
+    void reportGaitClock(const Options& opt) {
+        if (!selected(opt, "gait clock"))
+            return;
+
+        const float kSpeed = speedLevelMultipliers[SPEED_SLOW];
+        const uint32_t kRates[] = {config::movementIntervalUs, 10000, 3000};
+        const uint32_t kSampleUs = 60000;   // common multiple of the periods
+        const int kSamples = 40;
+
+        std::printf("\n%-16s %10s %10s %10s\n", "gait clock mm", "100 Hz", "333 Hz", "on key");
+
+        for (MovementMode mode = MOVEMENT_STANDBY; mode < MOVEMENT_TOTAL; mode++) {
+            std::vector<Locations> paths[3];
+            int keys = 0;
+            for (int r = 0; r < 3; r++) {
+                Movement movement(MOVEMENT_STANDBY);
+                movement.setSpeed(kSpeed);
+                std::srand(1);
+                movement.setMode(mode);
+                for (uint32_t t = kRates[r]; paths[r].size() < kSamples; t += kRates[r]) {
+                    const Locations& location = movement.next(kRates[r]);
+                    if (r == 0 && movement.angles())
+                        keys++;
+                    if (t % kSampleUs == 0)
+                        paths[r].push_back(location);
+                }
+            }
+
+            float worst[2] = {};
+            for (int r = 1; r < 3; r++)
+                for (int i = 0; i < kSamples; i++)
+                    for (int leg = 0; leg < 6; leg++) {
+                        Point3D d = paths[r][i].get(leg) - paths[0][i].get(leg);
+                        worst[r - 1] = std::max(worst[r - 1], std::sqrt(d.x_*d.x_ + d.y_*d.y_ + d.z_*d.z_));
+                    }
+
+            int frames = kSamples * kSampleUs / kRates[0];
+            std::printf("%-16s %10.3f %10.3f %9.0f%%\n", kModeNames[mode], worst[0], worst[1], 100.0 * keys / frames);
+        }
+    }
+
+    // Modelled bus time of each way to commit a frame, on two scratch boards
+    // before the servo boards are brought up. Every strategy must leave the
+    // emulated outputs at the last frame's pulses.
+    // MotionTask at a 2 ms period with a frame that busy-waits 300 µs, and
+    // 5.5 ms (past two more deadlines) every 40th frame. The late frames must
+    // not be replayed: the frame after one covers the gap by its elapsed
+    // time, and the elapsed times add up to the wall time.
+    namespace motion_task_bench {
+        constexpr uint32_t kPeriodUs = 2000;
+        constexpr int kFrames = 400;
+        std::atomic<int> frames{0};
+        std::atomic<int64_t> elapsedUs{0};
+        std::atomic<uint32_t> maxElapsedUs{0};
+
+        void frame(uint32_t elapsed) {
+            int n = frames++;
+            if (n > 0) {
+                elapsedUs += elapsed;
+                if (elapsed > maxElapsedUs)
+                    maxElapsedUs = elapsed;
+            }
+            auto until = Clock::now() + std::chrono::microseconds(n % 40 == 39 ? 5500 : 300);
+            while (Clock::now() < until)
+                ;
+        }
+    }
+
+    void reportMotionTask(const Options& opt) {
+        if (!selected(opt, "motion task"))
+            return;
+        namespace mt = motion_task_bench;
+
+        auto start = Clock::now();
+        auto firstFrame = start;
+        MotionTask::start(mt::frame, mt::kPeriodUs);
+        while (mt::frames < 1)
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        firstFrame = Clock::now();
+        while (mt::frames < mt::kFrames)
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        auto lastFrame = Clock::now();
+        MotionTask::stop();
+
+        MotionTask::Stats s = MotionTask::stats();
+        double wallUs = std::chrono::duration<double, std::micro>(lastFrame - firstFrame).count();
+        std::printf("\nmotion task, 2 ms period   frames  overruns  missed  late max us  frame max us  elapsed max us  elapsed/wall\n");
+        std::printf("%-25s %7u %9u %7u %12u %13u %15u %13.3f\n", "5.5 ms every 40th", s.frames, s.overruns, s.missed,
+            s.maxLateUs, s.maxFrameUs, mt::maxElapsedUs.load(), mt::elapsedUs / wallUs);
+    }
+
+    // What /metrics serves: the motion task walking forward at the firmware
+    // period through motionFrame(), the servo output task writing to the mock
+    // bus with wire time on, both recording as the firmware does.
+    namespace metrics_bench {
+        constexpr int kFrames = 100;
+        Leg (*legs)[6];
+        Movement* movement;
+        std::atomic<int> frames{0};
+
+        uint32_t clockUs() {
+            return (uint32_t)esp_timer_get_time();
+        }
+
+        void frame(uint32_t elapsedUs) {
+            FrameProfile profile{clockUs};
+            motionFrame(*movement, BodyPose{}, *legs, elapsedUs, &profile);
+            metrics::record(metrics::FRAME_NEXT, profile.next);
+            metrics::record(metrics::FRAME_POSE, profile.pose);
+            metrics::record(metrics::FRAME_IK, profile.ik);
+            metrics::record(metrics::FRAME_STAGE, profile.stage);
+            metrics::record(metrics::FRAME_COMMIT, profile.commit);
+            frames++;
+        }
+    }
+
+    void reportMetrics(const Options& opt) {
+        if (!selected(opt, "frame metrics"))
+            return;
+        namespace mb = metrics_bench;
+
+        Leg legs[6] = {{0}, {1}, {2}, {3}, {4}, {5}};
+        Movement movement(MOVEMENT_STANDBY);
+        movement.setMode(MOVEMENT_FORWARD);
+        mb::legs = &legs;
+        mb::movement = &movement;
+
+        i2c_mock_set_wire_time(true);
+        ServoOutput::start();
+        hexapod_metrics_set_counters(formatMotionCounters);
+        hexapod_metrics_reset();
+        MotionTask::start(mb::frame);
+        while (mb::frames < mb::kFrames)
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        MotionTask::stop();
+        ServoOutput::stop();
+
+        static const char* const kNames[] = {
+#define X(id, name, help) name,
+            HEXAPOD_METRICS(X)
+#undef X
+        };
+        std::printf("\n%-28s %7s %9s %7s %7s %7s\n", "frame metrics, forward", "count", "mean us", "p50", "p90", "p99");
+        for (int i = 0; i < metrics::METRIC_TOTAL; i++) {
+            metrics::Snapshot s = metrics::snapshot((metrics::Metric)i);
+            auto bound = [&](float q) {
+                uint32_t us = metrics::quantile(s, q);
+                return us == UINT32_MAX ? std::string("+Inf") : "<=" + std::to_string(us);
+            };
+            std::printf("%-28s %7u %9.1f %7s %7s %7s\n", kNames[i], s.count,
+                s.count ? (double)s.sumUs / s.count : 0.0,
+                bound(0.5f).c_str(), bound(0.9f).c_str(), bound(0.99f).c_str());
+        }
+
+        char block[2048];
+        size_t total = 0, largest = 0, len;
+        int blocks = 0;
+        for (; (len = hexapod_metrics_format(blocks, block, sizeof(block))); blocks++) {
+            total += len;
+            largest = std::max(largest, len);
+        }
+        std::printf("%-28s %zu bytes in %d blocks, largest %zu\n", "/metrics text", total, blocks, largest);
+    }
+
+    // The web server posts commands in bursts while a 1 kHz motion tick takes
+    // them: every state taken must be whole (all pose fields from the same
+    // post), the actions must arrive in order, and the newest command waits
+    // for one tick at most (plus the host's sleep jitter).
+    void reportMailbox(const Options& opt) {
+        if (!selected(opt, "command mailbox"))
+            return;
+
+        const int kPosts = 200000;
+        const auto kTick = std::chrono::microseconds(1000);
+        std::vector<std::atomic<int64_t>> postedNs(kPosts + 1);
+        std::atomic<bool> done{false};
+        auto nowNs = [] {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+        };
+
+        double postNs = 0;
+        std::thread producer([&] {
+            Clock::duration posting{};
+            for (int i = 1; i <= kPosts; i++) {
+                if (i % 1000 == 0) {
+                    command_action_t a{};
+                    a.type = COMMAND_CAL_OFFSET;
+                    a.value = (int16_t)(i / 1000);
+                    command_mailbox_push(a);
+                }
+                float pose[6];
+                for (float& v : pose)
+                    v = (float)i;
+                auto start = Clock::now();
+                command_mailbox_set_pose(pose);
+                posting += Clock::now() - start;
+                postedNs[i].store(nowNs(), std::memory_order_relaxed);
+                // a burst, then room for the consumer to catch up
+                if (i % 50 == 0)
+                    std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+            postNs = std::chrono::duration<double, std::nano>(posting).count() / kPosts;
+            done = true;
+        });
+
+        int ticks = 0, taken = 0, torn = 0, actions = 0, disorder = 0;
+        int lastValue = 0;
+        float lastPose = 0;
+        double takeMax = 0, waitMax = 0;
+        auto next = Clock::now();
+        for (;;) {
+            bool finished = done.load();
+            next += kTick;
+            std::this_thread::sleep_until(next);
+            ticks++;
+
+            command_state_t cmd;
+            auto start = Clock::now();
+            bool fresh = command_mailbox_take(&cmd);
+            takeMax = std::max(takeMax, std::chrono::duration<double, std::nano>(Clock::now() - start).count());
+            if (fresh) {
+                taken++;
+                bool whole = cmd.pose[0] > lastPose;
+                for (float v : cmd.pose)
+                    whole = whole && v == cmd.pose[0];
+                torn += !whole;
+                lastPose = cmd.pose[0];
+                // 0 while the producer has not stamped it yet, no wait to speak of
+                int64_t posted = postedNs[(int)cmd.pose[0]].load(std::memory_order_relaxed);
+                if (posted)
+                    waitMax = std::max(waitMax, (nowNs() - posted) * 1e-3);
+            }
+            command_action_t a;
+            while (command_mailbox_pop(&a)) {
+                actions++;
+                disorder += a.value != lastValue + 1;
+                lastValue = a.value;
+            }
+            if (finished && !fresh)
+                break;
+        }
+        producer.join();
+
+        command_mailbox_stats_t s = command_mailbox_stats();
+        std::printf("\ncommand mailbox, 1 kHz tick   post ns  take max ns  wait max us    taken  torn  actions  dropped  disorder\n");
+        std::printf("%-29s %8.1f %12.1f %12.1f %8d %5d %8d %8u %9d\n", "pose burst", postNs, takeMax, waitMax,
+            taken, torn, actions, s.dropped, disorder);
+        std::printf("  %d posts over %d ticks, the rest were overwritten before a tick took them\n", kPosts, ticks);
+    }
+
+    // The web server's posts through Hexapod::processCommands, one motion
+    // tick each: mode, speed and pose land as posted, only what a post
+    // changed is applied, bad commands and offsets outside calibration are
+    // rejected, and a save reaches NVS. False when a check failed.
+    bool reportCommands(const Options& opt) {
+        if (!selected(opt, "hexapod commands"))
+            return true;
+
+        bool ok = true;
+        auto check = [&](bool cond, const char* what) {
+            if (!cond) {
+                std::printf("FAIL: hexapod commands: %s\n", what);
+                ok = false;
+            }
+        };
+        auto tick = [] { Hexapod.processCommands(config::movementIntervalUs); };
+        auto push = [](uint8_t type, int leg, int part, int value) {
+            command_action_t a{};
+            a.type = type;
+            a.leg = (int8_t)leg;
+            a.part = (int8_t)part;
+            a.value = (int16_t)value;
+            command_mailbox_push(a);
+        };
+        auto offset = [](int leg, int part) {
+            int value;
+            Hexapod.calibrationGet(leg, part, value);
+            return value;
+        };
+
+        Hexapod.init(false);    // as hexapod_start()
+
+        // the page's "1 << mode" is decoded by the handler before the post
+        const float pose[6] = {5, -3, 10, 4, 0, -12};
+        command_mailbox_set_mode(MOVEMENT_FORWARD);
+        command_mailbox_set_speed(0.75f);
+        command_mailbox_set_pose(pose);
+        tick();
+        const BodyPose& p = Hexapod.getBodyPose();
+        check(Hexapod.getMovementMode() == MOVEMENT_FORWARD, "mode not applied");
+        check(Hexapod.getMovementSpeed() == 0.75f, "speed not applied");
+        check(p.roll == 5 && p.pitch == -3 && p.yaw == 10 && p.x == 4 && p.y == 0 && p.z == -12, "pose not applied");
+
+        // a speed alone leaves mode and pose alone, and is clamped
+        Hexapod.setBodyPose(BodyPose{});
+        command_mailbox_set_speed(4.0f);
+        tick();
+        check(Hexapod.getMovementMode() == MOVEMENT_FORWARD, "speed post switched the mode");
+        check(Hexapod.getMovementSpeed() == config::maxSpeed, "speed not clamped");
+        check(Hexapod.getBodyPose().isIdentity(), "speed post reapplied the pose");
+
+        command_mailbox_set_mode(MOVEMENT_TURNLEFT);
+        tick();
+        check(Hexapod.getMovementMode() == MOVEMENT_TURNLEFT, "second mode not applied");
+        command_mailbox_set_mode(MOVEMENT_TOTAL);
+        tick();
+        check(Hexapod.getMovementMode() == MOVEMENT_TURNLEFT, "out of range mode applied");
+
+        // offsets only between calibration start and save
+        push(COMMAND_CAL_OFFSET, 2, 1, 40);
+        tick();
+        check(offset(2, 1) == 0, "offset applied outside calibration");
+
+        push(COMMAND_CAL_START, 0, 0, 0);
+        push(COMMAND_CAL_OFFSET, 2, 1, 25);
+        push(COMMAND_CAL_OFFSET, 6, 0, 30);
+        push(COMMAND_CAL_OFFSET, 0, 3, 30);
+        command_mailbox_set_mode(MOVEMENT_FORWARD);
+        tick();
+        check(offset(2, 1) == 25, "offset not applied during calibration");
+        check(Hexapod.getMovementMode() == MOVEMENT_TURNLEFT, "frame ran during calibration");
+
+        push(COMMAND_CAL_SAVE, 0, 0, 0);
+        tick();
+        check(Hexapod.getMovementMode() == MOVEMENT_FORWARD, "walking not resumed after save");
+
+        int16_t stored[6][3] = {};
+        size_t length = sizeof(stored);
+        nvs_handle_t handle;
+        bool saved = nvs_open("hexapod", NVS_READONLY, &handle) == ESP_OK &&
+            nvs_get_blob(handle, "calibration", stored, &length) == ESP_OK;
+        if (saved)
+            nvs_close(handle);
+        check(saved && length == sizeof(stored) && stored[2][1] == 25 && stored[0][0] == 0, "offsets not saved to NVS");
+
+        Hexapod.clearOffset();
+        ServoOutput::stop();
+
+        std::printf("\n%-36s %s\n", "hexapod commands", ok ? "ok" : "FAILED");
+        return ok;
+    }
+
+    void reportBusTime(const Options& opt, Leg* legs[6]) {
+        if (!selected(opt, "bus time"))
+            return;
+
+        const int kFrames = 200;
+        const uint8_t kAddresses[2] = {0x60, 0x61};
+
+        // forward gait ticks per frame, in topology channel order
+        std::vector<std::vector<uint16_t>> ticks(kFrames, std::vector<uint16_t>(topology::kChannelCount));
+        Movement movement(MOVEMENT_STANDBY);
+        std::srand(1);
+        movement.setMode(MOVEMENT_FORWARD);
+        for (int f = 0; f < kFrames; f++) {
+            JointAngles solved;
+            BodyKinematics::solve(movement.next(config::movementIntervalUs), solved);
+            for (int leg = 0; leg < 6; leg++)
+                for (int j = 0; j < 3; j++)
+                    ticks[f][topology::kLegChannels[leg][j]] = legs[leg]->get(j)->angleToTicks(solved.angles[leg][j]);
+        }
+
+        i2c_master_bus_config_t config = {};
+        config.i2c_port = I2C_NUM_0;
+        i2c_master_bus_handle_t bus;
+        ESP_ERROR_CHECK(i2c_new_master_bus(&config, &bus));
+        pca9685_t boards[2];
+        for (int b = 0; b < 2; b++) {
+            ESP_ERROR_CHECK(pca9685_init(&boards[b], bus, kAddresses[b]));
+            ESP_ERROR_CHECK(pca9685_reset(&boards[b]));
+            ESP_ERROR_CHECK(pca9685_set_frequency(&boards[b], 50));
+        }
+
+        enum { kPerJoint, kBurst, kDirty, kStrategies };
+        const char* const names[kStrategies] = {"set_pwm per joint", "burst per board", "dirty runs"};
+        const uint32_t speeds[] = {100000, 400000, 1000000};
+
+        std::printf("\n%-24s %10s %10s %10s %8s %6s\n",
+            "bus us per frame, fwd", "100 kHz", "400 kHz", "1 MHz", "tx", "match");
+        for (int strategy = 0; strategy < kStrategies; strategy++) {
+            double us[3];
+            i2c_mock_stats_t stats;
+            for (int s = 0; s < 3; s++) {
+                i2c_mock_set_scl_hz(speeds[s]);
+                pca9685_frame_t frames[2] = {};
+                for (int b = 0; b < 2; b++)
+                    pca9685_turn_all_off(&boards[b]);
+
+                i2c_mock_reset_stats();
+                for (int f = 0; f < kFrames; f++) {
+                    for (int ch = 0; ch < topology::kChannelCount; ch++) {
+                        if (!ticks[f][ch])
+                            continue;   // not a servo channel
+                        int b = ch / PCA9685_CHANNELS, n = ch % PCA9685_CHANNELS;
+                        if (strategy == kPerJoint)
+                            pca9685_set_pwm(&boards[b], n, 0, ticks[f][ch]);
+                        else
+                            pca9685_frame_set(&frames[b], n, ticks[f][ch]);
+                    }
+                    if (strategy == kPerJoint)
+                        continue;
+                    for (int b = 0; b < 2; b++) {
+                        if (strategy == kBurst)
+                            pca9685_frame_invalidate(&frames[b]);
+                        pca9685_frame_commit(&boards[b], &frames[b]);
+                    }
+                }
+                i2c_mock_get_stats(&stats);
+                us[s] = stats.wire_ns / 1e3 / kFrames;
+            }
+
+            bool match = true;
+            for (int ch = 0; ch < topology::kChannelCount; ch++) {
+                pca9685_emu_t chip;
+                uint16_t on, off;
+                i2c_mock_chip(I2C_NUM_0, kAddresses[ch / PCA9685_CHANNELS], &chip);
+                pca9685_emu_output_t out = pca9685_emu_output(&chip, ch % PCA9685_CHANNELS, &on, &off);
+                if (ticks[kFrames - 1][ch])
+                    match &= out == PCA9685_EMU_PWM && on == 0 && off == ticks[kFrames - 1][ch];
+                else
+                    match &= out == PCA9685_EMU_FULL_OFF;
+            }
+            std::printf("%-24s %10.0f %10.0f %10.0f %8.2f %6s\n", names[strategy],
+                us[0], us[1], us[2], (double)stats.transactions / kFrames, match ? "yes" : "NO");
+        }
+        i2c_mock_set_scl_hz(0);
+
+        pca9685_emu_t chip;
+        i2c_mock_chip(I2C_NUM_0, kAddresses[0], &chip);
+        std::printf("  PWM period %.0f us, %u PRE_SCALE writes ignored while awake\n",
+            pca9685_emu_period_us(&chip), chip.prescale_ignored);
+
+        for (int b = 0; b < 2; b++)
+            ESP_ERROR_CHECK(pca9685_deinit(&boards[b]));
+        ESP_ERROR_CHECK(i2c_del_master_bus(bus));
+    }
+
+    // Compute/I2C overlap with wire time on (400 kHz): the same forward frames
+    // committed blocking and through ServoOutput, with the motion compute of
+    // the ESP32 stood in for by a spin. Both runs must leave the boards equal.
+    void reportPipelining(const Options& opt, Leg* legs[6]) {
+        if (!selected(opt, "servo output"))
+            return;
+
+        const int kFrames = 100;
+
+        auto run = [&](double computeUs) {
+            // leave standby first so every run starts from the same tips
+            Movement movement(MOVEMENT_STANDBY);
+            const Locations& home = movement.next(0);
+            JointAngles homeAngles;
+            BodyKinematics::solve(home, homeAngles);
+            for (int i = 0; i < 6; i++)
+                legs[i]->moveTipSolved(home.get(i), homeAngles.angles[i]);
+            Servo::commit();
+            ServoOutput::flush();
+            std::srand(1);      // setMode() picks a random entry
+            movement.setMode(MOVEMENT_FORWARD);
+
+            auto start = Clock::now();
+            for (int f = 0; f < kFrames; f++) {
+                auto computeEnd = Clock::now() + std::chrono::duration<double, std::micro>(computeUs);
+                const Locations& location = movement.next(config::movementIntervalUs);
+                JointAngles solved;
+                const JointAngles* angles = movement.angles();
+                if (!angles) {
+                    BodyKinematics::solve(location, solved);
+                    angles = &solved;
+                }
+                while (Clock::now() < computeEnd)
+                    ;
+                for (int i = 0; i < 6; i++)
+                    legs[i]->moveTipSolved(location.get(i), angles->angles[i]);
+                Servo::commit();
+            }
+            ServoOutput::flush();
+            return std::chrono::duration<double, std::micro>(Clock::now() - start).count() / kFrames;
+        };
+        auto snapshot = [&] {
+            std::vector<int> regs;
+            for (const topology::Board& board : topology::kBoards)
+                for (int reg = 0x06; reg < 0x46; reg++)
+                    regs.push_back(i2c_mock_peek(topology::kBuses[board.bus].port, board.address, reg));
+            return regs;
+        };
+
+        std::printf("\n%-24s %12s %12s %8s %8s %6s\n",
+            "servo output, 400 kHz", "blocking us", "task us", "merged", "written", "match");
+        i2c_mock_set_wire_time(true);
+        for (double computeUs : {250.0, 1000.0, 2500.0}) {
+            double blocking = run(computeUs);
+            std::vector<int> expected = snapshot();
+
+            ServoOutput::start();
+            ServoOutput::Stats before = ServoOutput::stats();
+            double pipelined = run(computeUs);
+            ServoOutput::Stats after = ServoOutput::stats();
+            ServoOutput::stop();
+
+            char name[32];
+            std::snprintf(name, sizeof(name), "compute %.0f us", computeUs);
+            std::printf("%-24s %12.0f %12.0f %8u %8u %6s\n", name, blocking, pipelined,
+                after.merged - before.merged, after.written - before.written,
+                snapshot() == expected ? "yes" : "NO");
+        }
+
+        // latency of one frame: commit to the last board done, every bus in parallel
+        ServoOutput::start();
+        Movement movement(MOVEMENT_STANDBY);
+        movement.setMode(MOVEMENT_FORWARD);
+        double wireUs = 0;
+        for (int f = 0; f < kFrames; f++) {
+            const Locations& location = movement.next(config::movementIntervalUs);
+            JointAngles solved;
+            BodyKinematics::solve(location, solved);
+            for (int i = 0; i < 6; i++)
+                legs[i]->moveTipSolved(location.get(i), solved.angles[i]);
+            auto start = Clock::now();
+            Servo::commit();
+            ServoOutput::flush();
+            wireUs += std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+        }
+        ServoOutput::stop();
+        std::printf("  frame commit to on the wire: %.0f us over %d bus(es)\n", wireUs / kFrames, topology::kBusCount);
+        i2c_mock_set_wire_time(false);
+    }
+
+    // false when a check that must hold failed
+    bool reportAccuracy(const Options& opt, Leg* legs[6], const std::vector<Locations>& frames, const std::vector<Sample>& samples) {
+        bool ok = true;
+
+        std::printf("\n%-36s %10s %10s %10s %8s\n", "IK -> FK round trip", "max um", "rms um", "max deg", "NaN");
+
+        for (const IkKernel& kernel : kIkKernels) {
+            if (!selected(opt, kernel.name))
+                continue;
+
+            double maxErr = 0, sumSq = 0, maxAngleErr = 0;
+            int nan = 0, count = 0;
+            for (const Sample& s : samples) {
+                float angles[3], reference[3];
+                Point3D out;
+                kernel.solve(s.local, angles);
+                Leg::_inverseKinematicsLibm(s.local, reference);
+                if (std::isnan(angles[0]) || std::isnan(angles[1]) || std::isnan(angles[2])) {
+                    nan++;
+                    continue;
+                }
+                Leg::_forwardKinematics(angles, out);
+
+                double dx = out.x_ - s.local.x_, dy = out.y_ - s.local.y_, dz = out.z_ - s.local.z_;
+                double err = std::sqrt(dx * dx + dy * dy + dz * dz);
+                maxErr = std::max(maxErr, err);
+                sumSq += err * err;
+                for (int j = 0; j < 3; j++)
+                    maxAngleErr = std::max(maxAngleErr, (double)std::fabs(angles[j] - reference[j]));
+                count++;
+            }
+            std::printf("%-36s %10.3f %10.3f %10.4f %8d\n", kernel.name, maxErr * 1000,
+                count ? std::sqrt(sumSq / count) * 1000 : 0.0, maxAngleErr, nan);
+        }
+        std::printf("  max deg: largest joint angle difference against Leg::_inverseKinematicsLibm\n");
+
+        double bodyErr = 0;
+        for (const Locations& frame : frames) {
+            JointAngles body;
+            BodyKinematics::solve(frame, body);
+            for (int i = 0; i < 6; i++) {
+                Point3D local;
+                float angles[3];
+                legs[i]->translateToLocal(frame.get(i), local);
+                Leg::_inverseKinematics(local, angles);
+                for (int j = 0; j < 3; j++)
+                    bodyErr = std::max(bodyErr, (double)std::fabs(body.angles[i][j] - angles[j]));
+            }
+        }
+        std::printf("\nBodyKinematics::solve vs per-leg Leg path: max %.2e deg\n", bodyErr);
+
+        // leg_geometry.h float transform against the old double one
+        double mountErr = 0, mountAngleErr = 0;
+        int identical = 0, points = 0;
+        for (const Locations& frame : frames) {
+            for (int i = 0; i < 6; i++) {
+                Point3D now, before;
+                float a[3], b[3];
+                legs[i]->translateToLocal(frame.get(i), now);
+                legacy::translateToLocal(i, frame.get(i), before);
+                Leg::_inverseKinematics(now, a);
+                Leg::_inverseKinematics(before, b);
+                mountErr = std::max({mountErr, (double)std::fabs(now.x_ - before.x_), (double)std::fabs(now.y_ - before.y_)});
+                for (int j = 0; j < 3; j++)
+                    mountAngleErr = std::max(mountAngleErr, (double)std::fabs(a[j] - b[j]));
+                identical += now == before;
+                points++;
+            }
+        }
+        std::printf("Leg mount transform vs legacy double: max %.4f um, %.2e deg after IK, %d/%d bit identical\n",
+            mountErr * 1000, mountAngleErr, identical, points);
+
+        // Table angle playback against solving the same locations; at half speed
+        // every other frame is between keyframes and gets solved. Standby and
+        // forward, entered through a mode switch, must play some frames.
+        for (float speed : {1.0f, 0.5f}) {
+            double playErr = 0;
+            int played = 0, solvedFrames = 0;
+            for (MovementMode mode = MOVEMENT_STANDBY; mode < MOVEMENT_TOTAL; mode++) {
+                Movement movement(MOVEMENT_STANDBY);
+                movement.setSpeed(speed);
+                movement.setMode(mode);
+                int modePlayed = 0;
+                for (int f = 0; f < 200; f++) {
+                    const Locations& location = movement.next(config::movementIntervalUs);
+                    const JointAngles* table = movement.angles();
+                    if (!table) {
+                        solvedFrames++;
+                        continue;
+                    }
+                    modePlayed++;
+                    JointAngles body;
+                    BodyKinematics::solve(location, body);
+                    for (int i = 0; i < 6; i++)
+                        for (int j = 0; j < 3; j++)
+                            playErr = std::max(playErr, (double)std::fabs(table->angles[i][j] - body.angles[i][j]));
+                    played++;
+                }
+                if (!modePlayed && (mode == MOVEMENT_STANDBY || mode == MOVEMENT_FORWARD)) {
+                    std::printf("FAIL: no %s frame played from the table angles (speed %.2f)\n", kModeNames[mode], speed);
+                    ok = false;
+                }
+            }
+            std::printf("Table angle playback (speed %.2f) vs IK: max %.4f deg, %d frames played, %d solved\n",
+                speed, playErr, played, solvedFrames);
+        }
+
+        // Grid answers against solving every point and checking the joint limits
+        {
+            const float kLimits[3][2] = {{-45, 45}, {-45, 75}, {-60, 60}};
+            std::vector<Point3D> points = randomLocalPoints(200000);
+            int agree = 0, reach = 0, clampedOk = 0, clampedTotal = 0;
+            double maxMove = 0;
+            uint32_t before = reachability::clampCount();
+            for (const Point3D& p : points) {
+                float a[3];
+                Leg::_inverseKinematics(p, a);
+                bool exact = true;
+                for (int j = 0; j < 3; j++)
+                    exact = exact && a[j] >= kLimits[j][0] && a[j] <= kLimits[j][1];
+                bool grid = reachability::reachable(p.x_, p.y_, p.z_);
+                agree += exact == grid;
+                reach += grid;
+
+                float x = p.x_, y = p.y_, z = p.z_;
+                if (reachability::clamp(x, y, z)) {
+                    clampedTotal++;
+                    clampedOk += reachability::reachable(x, y, z);
+                    double dx = x - p.x_, dy = y - p.y_, dz = z - p.z_;
+                    maxMove = std::max(maxMove, std::sqrt(dx * dx + dy * dy + dz * dz));
+                }
+            }
+            std::printf("\nreachability vs IK + joint limits: %d/%zu agree, %d reachable\n", agree, points.size(), reach);
+            std::printf("reachability::clamp: %d/%d moved points reachable, max move %.1f mm, clampCount +%u\n",
+                clampedOk, clampedTotal, maxMove, (unsigned)(reachability::clampCount() - before));
+
+            int gaitRejects = 0;
+            for (const Sample& s : samples)
+                gaitRejects += !reachability::reachable(s.local.x_, s.local.y_, s.local.z_);
+            std::printf("gait table points rejected: %d/%zu\n", gaitRejects, samples.size());
+        }
+
+        // Servo tick table against the pulse width at the real PCA9685 tick
+        // (prescale 121 at 50 Hz: 4.88 us), and the old integer 4 us tick
+        {
+            const double tickUs = 122 / 25.0;
+            double maxErr = 0, maxOldErr = 0;
+            for (int j = 0; j < 3; j++) {
+                Servo* servo = legs[0]->get(j);
+                float range = reachability::jointRange(j);
+                for (float a = -range; a <= range; a += 0.01f) {
+                    double exact = (1500 + a * (1000 / 90.0)) / tickUs;
+                    maxErr = std::max(maxErr, std::fabs(servo->angleToTicks(a) - exact));
+                    maxOldErr = std::max(maxOldErr, std::fabs((int)((1500 + a * (1000 / 90.0f)) / 4) - exact));
+                }
+            }
+            std::printf("\nServo::angleToTicks vs exact: max %.3f ticks (integer 4 us tick was off by %.1f ticks)\n",
+                maxErr, maxOldErr);
+        }
+
+        // fast_math.h documents its bounds over the whole domain, check them densely
+        const int kSteps = 200000;
+        double atanErr = 0, acosErr = 0, rsqrtErr = 0;
+        for (int i = 0; i <= kSteps; i++) {
+            double a = 2 * M_PI * i / kSteps;
+            float y = std::sin(a), x = std::cos(a);
+            double ref = std::atan2((double)y, (double)x);
+            double err = std::fabs(fastmath::atan2(y, x) - ref);
+            atanErr = std::max(atanErr, std::min(err, std::fabs(err - 2 * M_PI)));
+
+            float c = -1.0f + 2.0f * i / kSteps;
+            acosErr = std::max(acosErr, std::fabs(fastmath::acos(c) - std::acos((double)c)));
+
+            float r = 1e-3f + 1e5f * i / kSteps;
+            rsqrtErr = std::max(rsqrtErr, std::fabs(fastmath::rsqrt(r) * std::sqrt((double)r) - 1));
+        }
+        std::printf("\nfastmath::atan2 max %.2e rad, fastmath::acos max %.2e rad, fastmath::rsqrt max %.2e rel\n",
+            atanErr, acosErr, rsqrtErr);
+
+        return ok;
+    }
+
+    void usage(const char* argv0) {
+        std::printf("usage: %s [--reps N] [--filter TEXT] [--accuracy]\n", argv0);
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--reps") && i + 1 < argc) {
+            opt.reps = std::max(2, std::atoi(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--filter") && i + 1 < argc) {
+            opt.filter = argv[++i];
+        } else if (!std::strcmp(argv[i], "--accuracy")) {
+            opt.accuracy = true;
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    Leg* legs[6];
+    for (int i = 0; i < 6; i++)
+        legs[i] = new Leg(i);
+
+    // needs the bus to itself, before Servo::init()
+    reportBusTime(opt, legs);
+    Servo::init();
+
+    std::vector<Locations> frames = collectFrames();
+    std::vector<Sample> samples = collectSamples(legs, frames);
+
+#if CONFIG_HEXAPOD_FAST_IK
+    std::printf("Leg::_inverseKinematics uses the fast kernel\n\n");
+#else
+    std::printf("Leg::_inverseKinematics uses the libm kernel\n\n");
+#endif
+    std::printf("%-36s %10s %10s %10s\n", "case", "ns/op", "stddev", "min");
+    benchKinematics(opt, samples);
+    benchBody(opt, legs, frames);
+    benchReach(opt, samples);
+    benchMovement(opt);
+    benchGait(opt);
+    benchPose(opt, frames);
+    benchLog(opt);
+    benchServo(opt, legs, samples);
+    benchFrame(opt, legs, false);
+    benchFrame(opt, legs, true);
+    reportBusTraffic(opt, legs);
+    reportModeSwitch(opt);
+    reportGaitClock(opt);
+    reportGaitGenerator(opt);
+    reportPipelining(opt, legs);
+    reportMailbox(opt);
+    reportMotionTask(opt);
+    reportMetrics(opt);
+    bool ok = reportCommands(opt);
+
+    ok = (!opt.accuracy || reportAccuracy(opt, legs, frames, samples)) && ok;
+
+    for (int i = 0; i < 6; i++)
+        delete legs[i];
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,351 @@
+// Host bench of the ESP32 <-> STM32 motion link over a pseudo-terminal.
+//
+// Both ends run the firmware codec (motion_link.c): a thread plays the STM32
+// (answers PINGs, applies commands, sends telemetry every tick) on the slave
+// side, main plays the ESP32 on the master side. Reports the round trip and
+// the throughput through the pty, what the same traffic costs on the wire at
+// MOTION_LINK_BAUD, and how the decoder copes with a corrupted stream.
+//
+// The pty has no baud rate, its numbers are codec and kernel overhead only.
+
+#include <algorithm>
+#include <cerrno>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "config.h"
+#include "motion_link.h"
+
+namespace {
+
+    struct Options {
+        int pings = 2000;
+        double seconds = 1.0;
+    };
+
+    using Clock = std::chrono::steady_clock;
+
+    int64_t nowNs() {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch()).count();
+    }
+
+    // wire time of `bytes` at 8N1
+    double wireUs(size_t bytes) {
+        return bytes * 10 * 1e6 / MOTION_LINK_BAUD;
+    }
+
+    struct PingPayload {
+        uint32_t id;
+        int64_t sentNs;
+    } __attribute__((packed));
+
+    bool writeAll(int fd, const uint8_t* data, size_t len) {
+        while (len) {
+            ssize_t n = write(fd, data, len);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                if (errno == EAGAIN) {
+                    pollfd p = { fd, POLLOUT, 0 };
+                    poll(&p, 1, 100);
+                    continue;
+                }
+                return false;
+            }
+            data += n;
+            len -= n;
+        }
+        return true;
+    }
+
+    void makeRaw(int fd) {
+        termios t;
+        tcgetattr(fd, &t);
+        cfmakeraw(&t);
+        tcsetattr(fd, TCSANOW, &t);
+    }
+
+    // One end of the link: fd, decoder and its own tx seq
+    struct End {
+        int fd = -1;
+        uint8_t seq = 0;
+        motion_link_decoder_t dec;
+
+        End() { motion_link_decoder_init(&dec); }
+
+        bool send(uint8_t type, const void* payload, uint8_t len) {
+            uint8_t frame[MOTION_LINK_MAX_FRAME];
+            size_t size = motion_link_encode(frame, seq++, type, payload, len);
+            return writeAll(fd, frame, size);
+        }
+    };
+
+    // The STM32 side: commands in, PONG and telemetry out
+    struct Controller {
+        End end;
+        std::atomic<bool> stop{false};
+        std::atomic<uint32_t> commands{0};
+        std::atomic<uint32_t> badPayload{0};
+        uint8_t mode = 0;
+        uint8_t ackSeq = 0;
+        uint32_t ticks = 0;
+
+        static void onMessage(const motion_link_msg_t* msg, void* ctx) {
+            Controller* c = static_cast<Controller*>(ctx);
+            switch (msg->type) {
+            case MOTION_LINK_PING:
+                c->end.send(MOTION_LINK_PONG, msg->payload, msg->len);
+                return;
+            case MOTION_LINK_MODE:
+                c->mode = msg->payload[0];
+                break;
+            case MOTION_LINK_POSE: {
+                // the bench fills every float with the frame's seq
+                motion_link_pose_t pose;
+                std::memcpy(&pose, msg->payload, sizeof(pose));
+                if (msg->len != sizeof(pose) || pose.roll != msg->seq || pose.z != msg->seq)
+                    c->badPayload++;
+                break;
+            }
+            default:
+                break;
+            }
+            c->ackSeq = msg->seq;
+            c->commands++;
+        }
+
+        void sendTelemetry() {
+            motion_link_telemetry_t t = {};
+            t.ticks = ++ticks;
+            t.mode = mode;
+            t.ack_seq = ackSeq;
+            t.rx_errors = (uint16_t)(end.dec.stats.crc_errors + end.dec.stats.len_errors);
+            t.rx_lost = (uint16_t)end.dec.stats.lost;
+            end.send(MOTION_LINK_TELEMETRY, &t, sizeof(t));
+        }
+
+        void run() {
+            uint8_t buf[256];
+            auto nextTick = Clock::now();
+            while (!stop) {
+                pollfd p = { end.fd, POLLIN, 0 };
+                poll(&p, 1, 1);
+                ssize_t n = read(end.fd, buf, sizeof(buf));
+                if (n > 0)
+                    motion_link_decode(&end.dec, buf, n, onMessage, this);
+                if (Clock::now() >= nextTick) {
+                    sendTelemetry();
+                    nextTick += std::chrono::milliseconds(hexapod::config::movementInterval);
+                }
+            }
+        }
+    };
+
+    // The ESP32 side: answers land in these
+    struct Station {
+        End end;
+        uint32_t waitingId = 0;
+        int64_t rttNs = -1;
+        uint32_t telemetry = 0;
+        motion_link_telemetry_t last = {};
+
+        static void onMessage(const motion_link_msg_t* msg, void* ctx) {
+            Station* s = static_cast<Station*>(ctx);
+            if (msg->type == MOTION_LINK_PONG && msg->len == sizeof(PingPayload)) {
+                PingPayload p;
+                std::memcpy(&p, msg->payload, sizeof(p));
+                if (p.id == s->waitingId)
+                    s->rttNs = nowNs() - p.sentNs;
+            } else if (msg->type == MOTION_LINK_TELEMETRY && msg->len == sizeof(motion_link_telemetry_t)) {
+                std::memcpy(&s->last, msg->payload, sizeof(s->last));
+                s->telemetry++;
+            }
+        }
+
+        void pump(int timeoutMs) {
+            uint8_t buf[256];
+            pollfd p = { end.fd, POLLIN, 0 };
+            if (poll(&p, 1, timeoutMs) <= 0)
+                return;
+            ssize_t n = read(end.fd, buf, sizeof(buf));
+            if (n > 0)
+                motion_link_decode(&end.dec, buf, n, onMessage, this);
+        }
+    };
+
+    void checkCodec() {
+        const uint8_t check[] = "123456789";
+        uint16_t crc = motion_link_crc16(check, 9, 0xFFFF);
+        std::printf("crc16 check value 0x%04X (%s)\n", crc, crc == 0x29B1 ? "ok" : "WRONG, expected 0x29B1");
+
+        std::printf("frame bytes: pose %zu, frame %zu, telemetry %zu, wire us at %d baud: %.0f / %.0f / %.0f\n\n",
+                    MOTION_LINK_OVERHEAD + sizeof(motion_link_pose_t),
+                    MOTION_LINK_OVERHEAD + sizeof(motion_link_frame_t),
+                    MOTION_LINK_OVERHEAD + sizeof(motion_link_telemetry_t), MOTION_LINK_BAUD,
+                    wireUs(MOTION_LINK_OVERHEAD + sizeof(motion_link_pose_t)),
+                    wireUs(MOTION_LINK_OVERHEAD + sizeof(motion_link_frame_t)),
+                    wireUs(MOTION_LINK_OVERHEAD + sizeof(motion_link_telemetry_t)));
+    }
+
+    void benchRoundTrip(const Options& opt, Station& esp) {
+        std::vector<double> rtt;
+        int timeouts = 0;
+
+        for (int i = 0; i < opt.pings; i++) {
+            PingPayload p = { (uint32_t)i + 1, nowNs() };
+            esp.waitingId = p.id;
+            esp.rttNs = -1;
+            esp.end.send(MOTION_LINK_PING, &p, sizeof(p));
+
+            auto deadline = Clock::now() + std::chrono::milliseconds(100);
+            while (esp.rttNs < 0 && Clock::now() < deadline)
+                esp.pump(10);
+            if (esp.rttNs < 0)
+                timeouts++;
+            else
+                rtt.push_back(esp.rttNs / 1000.0);
+        }
+
+        std::sort(rtt.begin(), rtt.end());
+        auto pct = [&](double q) { return rtt.empty() ? 0.0 : rtt[std::min(rtt.size() - 1, (size_t)(q * rtt.size()))]; };
+        double wire = 2 * wireUs(MOTION_LINK_OVERHEAD + sizeof(PingPayload));
+
+        std::printf("%-24s %8s %8s %8s %8s %9s\n", "round trip (ping/pong)", "p50 us", "p99 us", "max us", "lost", "wire us");
+        std::printf("%-24s %8.1f %8.1f %8.1f %8d %9.0f\n\n", "pty", pct(0.5), pct(0.99),
+                    rtt.empty() ? 0.0 : rtt.back(), timeouts, wire);
+    }
+
+    // Blast POSE commands for opt.seconds, the controller checks each payload
+    void benchThroughput(const Options& opt, Station& esp, Controller& stm) {
+        uint32_t before = stm.commands;
+        uint32_t telemetryBefore = esp.telemetry;
+        size_t frameBytes = MOTION_LINK_OVERHEAD + sizeof(motion_link_pose_t);
+        uint32_t sent = 0;
+
+        auto start = Clock::now();
+        auto end = start + std::chrono::duration<double>(opt.seconds);
+        while (Clock::now() < end) {
+            float v = esp.end.seq;
+            motion_link_pose_t pose = { v, v, v, v, v, v };
+            esp.end.send(MOTION_LINK_POSE, &pose, sizeof(pose));
+            sent++;
+            esp.pump(0);
+        }
+        // let the controller drain the pty
+        for (int i = 0; i < 50 && stm.commands - before < sent; i++)
+            esp.pump(10);
+        double s = std::chrono::duration<double>(Clock::now() - start).count();
+
+        uint32_t got = stm.commands - before;
+        double wireRate = MOTION_LINK_BAUD / 10.0 / frameBytes;
+        std::printf("%-24s %10s %10s %10s %10s\n", "throughput (pose)", "frames/s", "MB/s", "received", "telemetry");
+        std::printf("%-24s %10.0f %10.2f %9.1f%% %10u\n", "pty", got / s, got * frameBytes / s / 1e6,
+                    sent ? 100.0 * got / sent : 0.0, esp.telemetry - telemetryBefore);
+        std::printf("%-24s %10.0f %10.3f\n", "wire at link baud", wireRate, wireRate * frameBytes / 1e6);
+        std::printf("  one pose per %d ms tick uses %.1f%% of the link\n\n", hexapod::config::movementInterval,
+                    100.0 * wireUs(frameBytes) / (hexapod::config::movementInterval * 1000.0));
+    }
+
+    // Decode a POSE stream with every byte flipped at `rate`, in memory
+    void benchCorruption() {
+        std::printf("%-24s %8s %8s %8s %8s %8s %8s\n", "corrupted stream", "sent", "decoded", "crc err", "len err", "lost", "bad");
+        for (double rate : {0.0, 0.0005, 0.005}) {
+            std::srand(1);
+            std::vector<uint8_t> stream;
+            const int frames = 20000;
+            for (int i = 0; i < frames; i++) {
+                uint8_t frame[MOTION_LINK_MAX_FRAME];
+                float v = (uint8_t)i;
+                motion_link_pose_t pose = { v, v, v, v, v, v };
+                size_t n = motion_link_encode(frame, (uint8_t)i, MOTION_LINK_POSE, &pose, sizeof(pose));
+                for (size_t j = 0; j < n; j++) {
+                    if (std::rand() < rate * RAND_MAX)
+                        frame[j] ^= 1 << (std::rand() % 8);
+                    stream.push_back(frame[j]);
+                }
+            }
+
+            Controller c;
+            motion_link_decode(&c.end.dec, stream.data(), stream.size(), [](const motion_link_msg_t* msg, void* ctx) {
+                Controller* c = static_cast<Controller*>(ctx);
+                motion_link_pose_t pose;
+                std::memcpy(&pose, msg->payload, sizeof(pose));
+                if (msg->type != MOTION_LINK_POSE || msg->len != sizeof(pose) || pose.roll != msg->seq || pose.z != msg->seq)
+                    c->badPayload++;
+                c->commands++;
+            }, &c);
+
+            char label[32];
+            std::snprintf(label, sizeof(label), "bit flips %.2f%%/byte", rate * 100);
+            const motion_link_stats_t& st = c.end.dec.stats;
+            std::printf("%-24s %8d %8u %8u %8u %8u %8u\n", label, frames, (unsigned)c.commands.load(), st.crc_errors,
+                        st.len_errors, st.lost, (unsigned)c.badPayload.load());
+        }
+        std::printf("\n");
+    }
+
+    void usage(const char* argv0) {
+        std::fprintf(stderr, "usage: %s [--pings N] [--seconds S]\n", argv0);
+    }
+}
+
+int main(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i < argc; i++) {
+        if (!std::strcmp(argv[i], "--pings") && i + 1 < argc) {
+            opt.pings = std::max(1, std::atoi(argv[++i]));
+        } else if (!std::strcmp(argv[i], "--seconds") && i + 1 < argc) {
+            opt.seconds = std::max(0.1, std::atof(argv[++i]));
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) || unlockpt(master)) {
+        std::perror("posix_openpt");
+        return 1;
+    }
+    int slave = open(ptsname(master), O_RDWR | O_NOCTTY);
+    if (slave < 0) {
+        std::perror("open pty slave");
+        return 1;
+    }
+    makeRaw(master);
+    makeRaw(slave);
+    fcntl(master, F_SETFL, O_NONBLOCK);
+    fcntl(slave, F_SETFL, O_NONBLOCK);
+
+    checkCodec();
+    benchCorruption();
+
+    Station esp;
+    esp.end.fd = master;
+    Controller stm;
+    stm.end.fd = slave;
+    std::thread controller([&] { stm.run(); });
+
+    benchRoundTrip(opt, esp);
+    benchThroughput(opt, esp, stm);
+
+    stm.stop = true;
+    controller.join();
+
+    const motion_link_stats_t& st = stm.end.dec.stats;
+    std::printf("controller rx: %u frames, %u crc, %u length errors, %u lost, %u skipped bytes, %u bad payloads\n",
+                st.frames, st.crc_errors, st.len_errors, st.lost, st.skipped, (unsigned)stm.badPayload.load());
+
+    close(slave);
+    close(master);
+    return 0;
+}
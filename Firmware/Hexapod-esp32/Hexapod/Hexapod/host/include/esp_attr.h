@@ -0,0 +1,5 @@
+// Host build shim: placement attributes have no meaning on the host.
+#pragma once
+
+#define IRAM_ATTR
+#define DRAM_ATTR
@@ -0,0 +1,7 @@
+// Host build shim: host threads are not pinned, they all report core 0.
+#pragma once
+
+static inline int esp_cpu_get_core_id(void)
+{
+    return 0;
+}
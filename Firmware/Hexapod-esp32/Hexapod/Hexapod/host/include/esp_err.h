@@ -0,0 +1,52 @@
+// Host build shim: subset of ESP-IDF esp_err.h used by the motion components.
+#pragma once
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef int esp_err_t;
+
+#define ESP_OK                  0
+#define ESP_FAIL                -1
+#define ESP_ERR_NO_MEM          0x101
+#define ESP_ERR_INVALID_ARG     0x102
+#define ESP_ERR_INVALID_STATE   0x103
+#define ESP_ERR_INVALID_SIZE    0x104
+#define ESP_ERR_NOT_FOUND       0x105
+#define ESP_ERR_NOT_SUPPORTED   0x106
+#define ESP_ERR_TIMEOUT         0x107
+
+static inline const char *esp_err_to_name(esp_err_t code)
+{
+    switch (code) {
+    case ESP_OK:                return "ESP_OK";
+    case ESP_FAIL:              return "ESP_FAIL";
+    case ESP_ERR_NO_MEM:        return "ESP_ERR_NO_MEM";
+    case ESP_ERR_INVALID_ARG:   return "ESP_ERR_INVALID_ARG";
+    case ESP_ERR_INVALID_STATE: return "ESP_ERR_INVALID_STATE";
+    case ESP_ERR_INVALID_SIZE:  return "ESP_ERR_INVALID_SIZE";
+    case ESP_ERR_NOT_FOUND:     return "ESP_ERR_NOT_FOUND";
+    case ESP_ERR_NOT_SUPPORTED: return "ESP_ERR_NOT_SUPPORTED";
+    case ESP_ERR_TIMEOUT:       return "ESP_ERR_TIMEOUT";
+    case 0x1102:                return "ESP_ERR_NVS_NOT_FOUND";
+    case 0x110c:                return "ESP_ERR_NVS_INVALID_LENGTH";
+    default:                    return "UNKNOWN ERROR";
+    }
+}
+
+#define ESP_ERROR_CHECK(x) do {                                              \
+        esp_err_t err_rc_ = (x);                                             \
+        if (err_rc_ != ESP_OK) {                                             \
+            fprintf(stderr, "ESP_ERROR_CHECK failed: %s at %s:%d\n",        \
+                    esp_err_to_name(err_rc_), __FILE__, __LINE__);           \
+            abort();                                                         \
+        }                                                                    \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,4 @@
+// Host build shim: nothing from esp_system.h is used by the host-built components.
+#pragma once
+
+#include "esp_err.h"
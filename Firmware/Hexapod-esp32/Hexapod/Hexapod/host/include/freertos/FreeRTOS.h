@@ -0,0 +1,20 @@
+// Host build shim: FreeRTOS tick types. One tick is one millisecond.
+#pragma once
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+
+#define portTICK_PERIOD_MS  ((TickType_t)1)
+#define portMAX_DELAY       ((TickType_t)0xffffffffUL)
+#define pdMS_TO_TICKS(ms)   ((TickType_t)(ms))
+#define pdTRUE              1
+#define pdFALSE             0
+#define pdPASS              pdTRUE
+
+#define portNUM_PROCESSORS  2
+
+// "ISRs" on the host are mock bus threads, there is no scheduler to yield to
+#define portYIELD_FROM_ISR(woken)   ((void)(woken))
@@ -0,0 +1,29 @@
+// Host build shim: tasks are pthreads, core affinity and priority are ignored.
+// Task delays are no-ops, the host mock bus models time on its own.
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct host_task_t *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+
+#define tskNO_AFFINITY  0x7FFFFFFF
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *created_task, BaseType_t core_id);
+
+/** @brief Only vTaskDelete(NULL) from the task itself is supported, it ends the thread. */
+void vTaskDelete(TaskHandle_t task);
+
+static inline void vTaskDelay(TickType_t ticks)
+{
+    (void)ticks;
+}
+
+#ifdef __cplusplus
+}
+#endif
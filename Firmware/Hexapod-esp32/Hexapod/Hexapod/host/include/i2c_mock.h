@@ -0,0 +1,45 @@
+// Host mock of the ESP-IDF i2c_master bus.
+//
+// Every chip is a PCA9685, see pca9685_emu.h. Chips are kept per port and
+// address, across device handles.
+//
+// A bus created with trans_queue_depth runs transfers asynchronously on a
+// thread and calls on_trans_done when each one finishes, like the driver's
+// asynchronous mode. Each transfer adds its modelled bus time to the stats,
+// it only takes that long in real time when wire time is enabled.
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/i2c_master.h"
+#include "pca9685_emu.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t transactions;  /*!< START..STOP sequences (write, or write+read) */
+    uint32_t bytes;         /*!< payload bytes on the wire, address bytes included */
+    uint64_t wire_ns;       /*!< modelled bus time, see i2c_emu_transfer_ns() */
+} i2c_mock_stats_t;
+
+/** @brief Traffic since start or the last i2c_mock_reset_stats(), all buses. */
+void i2c_mock_get_stats(i2c_mock_stats_t *stats);
+void i2c_mock_reset_stats(void);
+
+/** @brief Make each transfer take its modelled bus time in real time. */
+void i2c_mock_set_wire_time(bool enable);
+
+/** @brief Model every device at `scl_hz` instead of its configured speed, 0 to undo. */
+void i2c_mock_set_scl_hz(uint32_t scl_hz);
+
+/** @brief Read back a register of the device at `address` on `port`, -1 if absent. */
+int i2c_mock_peek(i2c_port_num_t port, uint16_t address, uint8_t reg);
+
+/** @brief Copy out the emulated chip at `address` on `port`, false if absent. */
+bool i2c_mock_chip(i2c_port_num_t port, uint16_t address, pca9685_emu_t *out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,61 @@
+// Host emulator of the PCA9685 register file and of I2C bus timing.
+//
+// Every device on the host mock bus (i2c_master.c) is one of these. Modelled:
+//  - power-on values (MODE1 0x11 asleep, MODE2 0x04, LEDn full off, PRE_SCALE 0x1E)
+//  - MODE1: RESTART reads 1 after going to sleep, writing 1 clears it; AI
+//  - the register pointer: increments after each data byte only with MODE1.AI
+//    set, rolling over from 0x45 (LED15_OFF_H) to 0x00 like the chip
+//  - PRE_SCALE only writable while asleep (otherwise ignored and counted),
+//    values below 3 read back as 3
+//  - ALL_LED_* writes load the byte into all 16 LEDn registers, read as 0
+//  - reserved registers 0x46..0xF9 ignore writes and read as 0
+// Not modelled: the oscillator, sub/all-call addressing, the 500 us wake-up.
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint8_t regs[256];
+    uint8_t pointer;
+    uint32_t led_writes;        /*!< bytes written to LEDn or ALL_LED registers */
+    uint32_t prescale_ignored;  /*!< PRE_SCALE writes while awake */
+    uint32_t reserved_writes;   /*!< writes to 0x46..0xF9 */
+} pca9685_emu_t;
+
+typedef enum {
+    PCA9685_EMU_PWM,
+    PCA9685_EMU_FULL_ON,
+    PCA9685_EMU_FULL_OFF,
+} pca9685_emu_output_t;
+
+void pca9685_emu_power_on(pca9685_emu_t *chip);
+
+/** @brief Write transfer: data[0] selects the register, the rest is data. */
+void pca9685_emu_write(pca9685_emu_t *chip, const uint8_t *data, size_t size);
+
+/** @brief Read transfer from the current register pointer. */
+void pca9685_emu_read(pca9685_emu_t *chip, uint8_t *data, size_t size);
+
+/** @brief What output `channel` drives, full off wins over full on as on the chip. */
+pca9685_emu_output_t pca9685_emu_output(const pca9685_emu_t *chip, int channel, uint16_t *on, uint16_t *off);
+
+/** @brief PWM period from PRE_SCALE and the 25 MHz internal oscillator. */
+float pca9685_emu_period_us(const pca9685_emu_t *chip);
+
+/**
+ * @brief Time one transfer holds the bus: START, 9 SCL cycles per byte
+ * (address included), STOP and the bus free time before the next START.
+ * A read adds a repeated START and the read address. The START/STOP/free
+ * times are the I2C minimums of the speed class (<= 100k, <= 400k, Fm+).
+ */
+uint64_t i2c_emu_transfer_ns(uint32_t scl_hz, size_t write_bytes, size_t read_bytes);
+
+#ifdef __cplusplus
+}
+#endif
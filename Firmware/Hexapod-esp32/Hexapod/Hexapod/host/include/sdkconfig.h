@@ -0,0 +1,4 @@
+// Host build shim: stands in for the sdkconfig.h generated by menuconfig.
+// Host-side equivalents of CONFIG_ options are passed as compile definitions
+// from host/CMakeLists.txt.
+#pragma once
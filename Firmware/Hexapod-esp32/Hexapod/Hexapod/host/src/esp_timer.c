@@ -0,0 +1,86 @@
+// pthread implementation of the esp_timer periodic timer shim. A timer fires
+// on absolute deadlines, start + n * period, so it does not drift; a deadline
+// that passed while the callback ran fires at once, like a late esp_timer.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "esp_timer.h"
+
+struct host_timer_t {
+    esp_timer_create_args_t args;
+    pthread_t thread;
+    uint64_t period;
+    atomic_bool running;
+};
+
+static void *timer_thread(void *arg)
+{
+    struct host_timer_t *timer = arg;
+    struct timespec deadline;
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+
+    while (atomic_load(&timer->running)) {
+        deadline.tv_nsec += (long)(timer->period % 1000000) * 1000L;
+        deadline.tv_sec += timer->period / 1000000;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &deadline, NULL) != 0)
+            ;
+        if (atomic_load(&timer->running))
+            timer->args.callback(timer->args.arg);
+    }
+    return NULL;
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *out_handle)
+{
+    if (!args || !args->callback || !out_handle)
+        return ESP_ERR_INVALID_ARG;
+
+    struct host_timer_t *timer = calloc(1, sizeof(*timer));
+    if (!timer)
+        return ESP_ERR_NO_MEM;
+    timer->args = *args;
+    *out_handle = timer;
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+    if (atomic_load(&timer->running))
+        return ESP_ERR_INVALID_STATE;
+
+    timer->period = period;
+    atomic_store(&timer->running, true);
+    if (pthread_create(&timer->thread, NULL, timer_thread, timer) != 0) {
+        atomic_store(&timer->running, false);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+    if (!atomic_exchange(&timer->running, false))
+        return ESP_ERR_INVALID_STATE;
+
+    // a callback in flight completes before stop returns
+    pthread_join(timer->thread, NULL);
+    return ESP_OK;
+}
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+    if (atomic_load(&timer->running))
+        return ESP_ERR_INVALID_STATE;
+
+    free(timer);
+    return ESP_OK;
+}
@@ -0,0 +1,140 @@
+// pthread implementation of the FreeRTOS task and semaphore shims.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+
+struct host_task_t {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+};
+
+struct host_semaphore_t {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    UBaseType_t count;
+    UBaseType_t max;
+};
+
+static __thread struct host_task_t *s_current;
+
+static void *task_entry(void *arg)
+{
+    s_current = arg;
+    s_current->fn(s_current->arg);
+    // returning from a task function is an error in FreeRTOS, tolerated here
+    vTaskDelete(NULL);
+    return NULL;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack_depth, void *arg,
+                                   UBaseType_t priority, TaskHandle_t *created_task, BaseType_t core_id)
+{
+    (void)name;
+    (void)stack_depth;
+    (void)priority;
+    (void)core_id;
+
+    struct host_task_t *task = calloc(1, sizeof(*task));
+    if (!task) return pdFALSE;
+    task->fn = fn;
+    task->arg = arg;
+    if (pthread_create(&task->thread, NULL, task_entry, task) != 0) {
+        free(task);
+        return pdFALSE;
+    }
+    // the task struct lives until vTaskDelete(), like a TCB; nobody joins the thread
+    pthread_detach(task->thread);
+    if (created_task) *created_task = task;
+    return pdPASS;
+}
+
+void vTaskDelete(TaskHandle_t task)
+{
+    if (task != NULL) return;
+
+    free(s_current);
+    s_current = NULL;
+    pthread_exit(NULL);
+}
+
+static SemaphoreHandle_t semaphore_create(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    struct host_semaphore_t *sem = calloc(1, sizeof(*sem));
+    if (!sem) return NULL;
+    pthread_mutex_init(&sem->lock, NULL);
+    pthread_cond_init(&sem->cond, NULL);
+    sem->count = initial_count;
+    sem->max = max_count;
+    return sem;
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void)
+{
+    return semaphore_create(1, 0);
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max_count, UBaseType_t initial_count)
+{
+    return semaphore_create(max_count, initial_count);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem)
+{
+    if (!sem) return;
+    pthread_cond_destroy(&sem->cond);
+    pthread_mutex_destroy(&sem->lock);
+    free(sem);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks_to_wait)
+{
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    if (ticks_to_wait != portMAX_DELAY) {
+        deadline.tv_sec += ticks_to_wait / 1000;
+        deadline.tv_nsec += (long)(ticks_to_wait % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000000000L;
+        }
+    }
+
+    pthread_mutex_lock(&sem->lock);
+    while (sem->count == 0) {
+        if (ticks_to_wait == portMAX_DELAY) {
+            pthread_cond_wait(&sem->cond, &sem->lock);
+        } else if (pthread_cond_timedwait(&sem->cond, &sem->lock, &deadline) == ETIMEDOUT) {
+            break;
+        }
+    }
+    BaseType_t taken = sem->count > 0;
+    if (taken) sem->count--;
+    pthread_mutex_unlock(&sem->lock);
+    return taken ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    pthread_mutex_lock(&sem->lock);
+    BaseType_t given = sem->count < sem->max;
+    if (given) {
+        sem->count++;
+        pthread_cond_signal(&sem->cond);
+    }
+    pthread_mutex_unlock(&sem->lock);
+    return given ? pdTRUE : pdFALSE;
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *higher_priority_task_woken)
+{
+    if (higher_priority_task_woken) *higher_priority_task_woken = pdFALSE;
+    return xSemaphoreGive(sem);
+}
@@ -0,0 +1,331 @@
+// In-memory mock of the ESP-IDF i2c_master API for host builds, see i2c_mock.h.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "driver/i2c_master.h"
+#include "i2c_mock.h"
+#include "pca9685_emu.h"
+
+#define MOCK_MAX_DEVICES 8
+#define MOCK_MAX_QUEUE   32
+
+// one chip, outlives device handles so a bus can be torn down and
+// reopened without the chips losing state
+typedef struct {
+    int used;
+    i2c_port_num_t port;
+    uint16_t address;
+    pca9685_emu_t emu;
+} mock_chip_t;
+
+struct i2c_master_dev_t {
+    struct i2c_master_bus_t *bus;
+    mock_chip_t *chip;
+    uint32_t scl_speed_hz;
+    i2c_master_callback_t on_trans_done;
+    void *user_data;
+};
+
+typedef struct {
+    struct i2c_master_dev_t *dev;
+    const uint8_t *data;
+    size_t size;
+} mock_transfer_t;
+
+struct i2c_master_bus_t {
+    i2c_port_num_t port;
+    struct i2c_master_dev_t *devices[MOCK_MAX_DEVICES];
+
+    // asynchronous transfers, run in order by the bus thread
+    size_t queue_depth;
+    mock_transfer_t queue[MOCK_MAX_QUEUE];
+    size_t head;
+    size_t count;
+    int stopping;
+    pthread_t thread;
+    pthread_cond_t cond;
+};
+
+// one lock for the stats, the queues and the register files
+static pthread_mutex_t s_lock = PTHREAD_MUTEX_INITIALIZER;
+static i2c_mock_stats_t s_stats;
+static struct i2c_master_bus_t *s_buses[2];
+static mock_chip_t s_chips[2 * MOCK_MAX_DEVICES];
+static int s_wire_time;
+static uint32_t s_scl_hz;
+
+static uint64_t transfer_ns(const struct i2c_master_dev_t *dev, size_t write_size, size_t read_size)
+{
+    uint32_t hz = s_scl_hz ? s_scl_hz : dev->scl_speed_hz ? dev->scl_speed_hz : 100000;
+    return i2c_emu_transfer_ns(hz, write_size, read_size);
+}
+
+static void wire_delay(uint64_t ns)
+{
+    if (!s_wire_time) return;
+
+    struct timespec ts = { (time_t)(ns / 1000000000ULL), (long)(ns % 1000000000ULL) };
+    nanosleep(&ts, NULL);
+}
+
+// call with s_lock held
+static void account(size_t bytes, uint64_t ns)
+{
+    s_stats.transactions++;
+    s_stats.bytes += bytes;
+    s_stats.wire_ns += ns;
+}
+
+static mock_chip_t *find_chip(i2c_port_num_t port, uint16_t address, int create)
+{
+    for (int i = 0; i < 2 * MOCK_MAX_DEVICES; i++) {
+        if (s_chips[i].used && s_chips[i].port == port && s_chips[i].address == address)
+            return &s_chips[i];
+    }
+    if (!create) return NULL;
+    for (int i = 0; i < 2 * MOCK_MAX_DEVICES; i++) {
+        if (s_chips[i].used) continue;
+        s_chips[i].used = 1;
+        s_chips[i].port = port;
+        s_chips[i].address = address;
+        pca9685_emu_power_on(&s_chips[i].emu);
+        return &s_chips[i];
+    }
+    return NULL;
+}
+
+static void *bus_thread(void *arg)
+{
+    struct i2c_master_bus_t *bus = arg;
+
+    pthread_mutex_lock(&s_lock);
+    for (;;) {
+        while (bus->count == 0 && !bus->stopping)
+            pthread_cond_wait(&bus->cond, &s_lock);
+        if (bus->count == 0)
+            break;
+
+        // the transfer stays queued while on the wire, like the driver the
+        // buffer is read at the end, so early reuse by the caller shows up
+        mock_transfer_t t = bus->queue[bus->head];
+        uint64_t ns = transfer_ns(t.dev, t.size, 0);
+        pthread_mutex_unlock(&s_lock);
+        wire_delay(ns);
+        pthread_mutex_lock(&s_lock);
+
+        account(1 + t.size, ns);
+        pca9685_emu_write(&t.dev->chip->emu, t.data, t.size);
+        bus->head = (bus->head + 1) % MOCK_MAX_QUEUE;
+        bus->count--;
+        pthread_cond_broadcast(&bus->cond);
+
+        i2c_master_callback_t cb = t.dev->on_trans_done;
+        void *user_data = t.dev->user_data;
+        pthread_mutex_unlock(&s_lock);
+        if (cb) {
+            i2c_master_event_data_t evt = { I2C_EVENT_DONE };
+            cb(t.dev, &evt, user_data);
+        }
+        pthread_mutex_lock(&s_lock);
+    }
+    pthread_mutex_unlock(&s_lock);
+    return NULL;
+}
+
+esp_err_t i2c_new_master_bus(const i2c_master_bus_config_t *bus_config, i2c_master_bus_handle_t *ret_bus_handle)
+{
+    if (!bus_config || !ret_bus_handle || bus_config->i2c_port < 0 || bus_config->i2c_port > 1)
+        return ESP_ERR_INVALID_ARG;
+    if (bus_config->trans_queue_depth > MOCK_MAX_QUEUE)
+        return ESP_ERR_INVALID_ARG;
+    if (s_buses[bus_config->i2c_port])
+        return ESP_ERR_INVALID_STATE;
+
+    struct i2c_master_bus_t *bus = calloc(1, sizeof(*bus));
+    if (!bus) return ESP_ERR_NO_MEM;
+    bus->port = bus_config->i2c_port;
+    bus->queue_depth = bus_config->trans_queue_depth;
+    if (bus->queue_depth) {
+        pthread_cond_init(&bus->cond, NULL);
+        if (pthread_create(&bus->thread, NULL, bus_thread, bus) != 0) {
+            free(bus);
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    s_buses[bus->port] = bus;
+    *ret_bus_handle = bus;
+    return ESP_OK;
+}
+
+esp_err_t i2c_del_master_bus(i2c_master_bus_handle_t bus_handle)
+{
+    if (!bus_handle) return ESP_ERR_INVALID_ARG;
+    for (int i = 0; i < MOCK_MAX_DEVICES; i++) {
+        if (bus_handle->devices[i]) return ESP_ERR_INVALID_STATE;
+    }
+    if (bus_handle->queue_depth) {
+        pthread_mutex_lock(&s_lock);
+        bus_handle->stopping = 1;
+        pthread_cond_broadcast(&bus_handle->cond);
+        pthread_mutex_unlock(&s_lock);
+        pthread_join(bus_handle->thread, NULL);
+        pthread_cond_destroy(&bus_handle->cond);
+    }
+    s_buses[bus_handle->port] = NULL;
+    free(bus_handle);
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_bus_add_device(i2c_master_bus_handle_t bus_handle, const i2c_device_config_t *dev_config, i2c_master_dev_handle_t *ret_handle)
+{
+    if (!bus_handle || !dev_config || !ret_handle) return ESP_ERR_INVALID_ARG;
+
+    for (int i = 0; i < MOCK_MAX_DEVICES; i++) {
+        if (bus_handle->devices[i]) continue;
+
+        struct i2c_master_dev_t *dev = calloc(1, sizeof(*dev));
+        if (!dev) return ESP_ERR_NO_MEM;
+        pthread_mutex_lock(&s_lock);
+        dev->chip = find_chip(bus_handle->port, dev_config->device_address, 1);
+        pthread_mutex_unlock(&s_lock);
+        if (!dev->chip) {
+            free(dev);
+            return ESP_ERR_NO_MEM;
+        }
+        dev->bus = bus_handle;
+        dev->scl_speed_hz = dev_config->scl_speed_hz;
+        bus_handle->devices[i] = dev;
+        *ret_handle = dev;
+        return ESP_OK;
+    }
+    return ESP_ERR_NO_MEM;
+}
+
+esp_err_t i2c_master_bus_rm_device(i2c_master_dev_handle_t handle)
+{
+    if (!handle) return ESP_ERR_INVALID_ARG;
+
+    // like the driver, removing a device with transfers in flight is a caller bug
+    struct i2c_master_bus_t *bus = handle->bus;
+    pthread_mutex_lock(&s_lock);
+    for (size_t i = 0; i < bus->count; i++) {
+        if (bus->queue[(bus->head + i) % MOCK_MAX_QUEUE].dev == handle) {
+            pthread_mutex_unlock(&s_lock);
+            return ESP_ERR_INVALID_STATE;
+        }
+    }
+    for (int i = 0; i < MOCK_MAX_DEVICES; i++) {
+        if (bus->devices[i] == handle) bus->devices[i] = NULL;
+    }
+    pthread_mutex_unlock(&s_lock);
+    free(handle);
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_register_event_callbacks(i2c_master_dev_handle_t i2c_dev, const i2c_master_event_callbacks_t *cbs, void *user_data)
+{
+    if (!i2c_dev || !cbs) return ESP_ERR_INVALID_ARG;
+    // the driver needs the transaction queue for asynchronous transfers
+    if (i2c_dev->bus->queue_depth == 0) return ESP_ERR_INVALID_STATE;
+
+    pthread_mutex_lock(&s_lock);
+    i2c_dev->on_trans_done = cbs->on_trans_done;
+    i2c_dev->user_data = user_data;
+    pthread_mutex_unlock(&s_lock);
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit(i2c_master_dev_handle_t i2c_dev, const uint8_t *write_buffer, size_t write_size, int xfer_timeout_ms)
+{
+    (void)xfer_timeout_ms;
+    if (!i2c_dev || !write_buffer || write_size == 0) return ESP_ERR_INVALID_ARG;
+
+    struct i2c_master_bus_t *bus = i2c_dev->bus;
+    if (bus->queue_depth) {
+        // asynchronous: queue and return, waits only for a free queue slot
+        pthread_mutex_lock(&s_lock);
+        while (bus->count >= bus->queue_depth)
+            pthread_cond_wait(&bus->cond, &s_lock);
+        mock_transfer_t *t = &bus->queue[(bus->head + bus->count) % MOCK_MAX_QUEUE];
+        t->dev = i2c_dev;
+        t->data = write_buffer;
+        t->size = write_size;
+        bus->count++;
+        pthread_cond_broadcast(&bus->cond);
+        pthread_mutex_unlock(&s_lock);
+        return ESP_OK;
+    }
+
+    uint64_t ns = transfer_ns(i2c_dev, write_size, 0);
+    wire_delay(ns);
+    pthread_mutex_lock(&s_lock);
+    account(1 + write_size, ns);
+    pca9685_emu_write(&i2c_dev->chip->emu, write_buffer, write_size);
+    pthread_mutex_unlock(&s_lock);
+    return ESP_OK;
+}
+
+esp_err_t i2c_master_transmit_receive(i2c_master_dev_handle_t i2c_dev, const uint8_t *write_buffer, size_t write_size, uint8_t *read_buffer, size_t read_size, int xfer_timeout_ms)
+{
+    (void)xfer_timeout_ms;
+    if (!i2c_dev || !write_buffer || write_size == 0 || !read_buffer) return ESP_ERR_INVALID_ARG;
+    // reads complete later on an asynchronous bus, no caller here handles that
+    if (i2c_dev->bus->queue_depth) return ESP_ERR_NOT_SUPPORTED;
+
+    // write phase, repeated START, read phase
+    uint64_t ns = transfer_ns(i2c_dev, write_size, read_size);
+    wire_delay(ns);
+    pthread_mutex_lock(&s_lock);
+    account(1 + write_size + 1 + read_size, ns);
+    pca9685_emu_write(&i2c_dev->chip->emu, write_buffer, write_size);
+    pca9685_emu_read(&i2c_dev->chip->emu, read_buffer, read_size);
+    pthread_mutex_unlock(&s_lock);
+    return ESP_OK;
+}
+
+void i2c_mock_get_stats(i2c_mock_stats_t *stats)
+{
+    pthread_mutex_lock(&s_lock);
+    *stats = s_stats;
+    pthread_mutex_unlock(&s_lock);
+}
+
+void i2c_mock_reset_stats(void)
+{
+    pthread_mutex_lock(&s_lock);
+    memset(&s_stats, 0, sizeof(s_stats));
+    pthread_mutex_unlock(&s_lock);
+}
+
+void i2c_mock_set_wire_time(bool enable)
+{
+    s_wire_time = enable;
+}
+
+void i2c_mock_set_scl_hz(uint32_t scl_hz)
+{
+    s_scl_hz = scl_hz;
+}
+
+int i2c_mock_peek(i2c_port_num_t port, uint16_t address, uint8_t reg)
+{
+    pthread_mutex_lock(&s_lock);
+    mock_chip_t *chip = find_chip(port, address, 0);
+    int value = chip ? chip->emu.regs[reg] : -1;
+    pthread_mutex_unlock(&s_lock);
+    return value;
+}
+
+bool i2c_mock_chip(i2c_port_num_t port, uint16_t address, pca9685_emu_t *out)
+{
+    pthread_mutex_lock(&s_lock);
+    mock_chip_t *chip = find_chip(port, address, 0);
+    if (chip) *out = chip->emu;
+    pthread_mutex_unlock(&s_lock);
+    return chip != NULL;
+}
@@ -0,0 +1,118 @@
+// In-memory NVS for the host build: a handful of namespace/key blobs, enough
+// for the components' settings. Handles are namespace indices + 1.
+
+#include <pthread.h>
+#include <string.h>
+
+#include "nvs_flash.h"
+
+#define MAX_NAMESPACES  4
+#define MAX_ENTRIES     16
+#define MAX_NAME        16
+#define MAX_BLOB        256
+
+typedef struct {
+    int ns;
+    char key[MAX_NAME];
+    size_t length;
+    uint8_t value[MAX_BLOB];
+} entry_t;
+
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static char namespaces[MAX_NAMESPACES][MAX_NAME];
+static entry_t entries[MAX_ENTRIES];
+static int entry_count;
+
+static entry_t *find(int ns, const char *key)
+{
+    for (int i = 0; i < entry_count; i++)
+        if (entries[i].ns == ns && !strcmp(entries[i].key, key))
+            return &entries[i];
+    return NULL;
+}
+
+esp_err_t nvs_flash_init(void)
+{
+    return ESP_OK;
+}
+
+esp_err_t nvs_flash_erase(void)
+{
+    pthread_mutex_lock(&lock);
+    entry_count = 0;
+    pthread_mutex_unlock(&lock);
+    return ESP_OK;
+}
+
+esp_err_t nvs_open(const char *name, nvs_open_mode_t open_mode, nvs_handle_t *out_handle)
+{
+    (void)open_mode;
+    if (strlen(name) >= MAX_NAME)
+        return ESP_ERR_INVALID_ARG;
+
+    pthread_mutex_lock(&lock);
+    int ns = 0;
+    while (ns < MAX_NAMESPACES && namespaces[ns][0] && strcmp(namespaces[ns], name))
+        ns++;
+    if (ns < MAX_NAMESPACES && !namespaces[ns][0])
+        strcpy(namespaces[ns], name);
+    pthread_mutex_unlock(&lock);
+
+    if (ns == MAX_NAMESPACES)
+        return ESP_ERR_NO_MEM;
+    *out_handle = (nvs_handle_t)ns + 1;
+    return ESP_OK;
+}
+
+esp_err_t nvs_get_blob(nvs_handle_t handle, const char *key, void *out_value, size_t *length)
+{
+    esp_err_t err = ESP_OK;
+    pthread_mutex_lock(&lock);
+    entry_t *e = find((int)handle - 1, key);
+    if (!e) {
+        err = ESP_ERR_NVS_NOT_FOUND;
+    } else if (!out_value) {
+        *length = e->length;
+    } else if (*length < e->length) {
+        err = ESP_ERR_NVS_INVALID_LENGTH;
+    } else {
+        memcpy(out_value, e->value, e->length);
+        *length = e->length;
+    }
+    pthread_mutex_unlock(&lock);
+    return err;
+}
+
+esp_err_t nvs_set_blob(nvs_handle_t handle, const char *key, const void *value, size_t length)
+{
+    if (length > MAX_BLOB || strlen(key) >= MAX_NAME)
+        return ESP_ERR_INVALID_SIZE;
+
+    esp_err_t err = ESP_OK;
+    pthread_mutex_lock(&lock);
+    entry_t *e = find((int)handle - 1, key);
+    if (!e && entry_count < MAX_ENTRIES) {
+        e = &entries[entry_count++];
+        e->ns = (int)handle - 1;
+        strcpy(e->key, key);
+    }
+    if (e) {
+        memcpy(e->value, value, length);
+        e->length = length;
+    } else {
+        err = ESP_ERR_NVS_NO_FREE_PAGES;
+    }
+    pthread_mutex_unlock(&lock);
+    return err;
+}
+
+esp_err_t nvs_commit(nvs_handle_t handle)
+{
+    (void)handle;
+    return ESP_OK;
+}
+
+void nvs_close(nvs_handle_t handle)
+{
+    (void)handle;
+}
@@ -0,0 +1,135 @@
+// PCA9685 register file and I2C timing emulator, see pca9685_emu.h.
+
+#include <string.h>
+
+#include "pca9685_emu.h"
+
+#define REG_MODE1       0x00
+#define REG_MODE2       0x01
+#define REG_SUBADR1     0x02
+#define REG_SUBADR2     0x03
+#define REG_SUBADR3     0x04
+#define REG_ALLCALLADR  0x05
+#define REG_LED0_ON_L   0x06
+#define REG_LED15_OFF_H 0x45
+#define REG_ALL_LED_ON_L    0xFA
+#define REG_ALL_LED_OFF_H   0xFD
+#define REG_PRE_SCALE   0xFE
+
+#define MODE1_RESTART   0x80
+#define MODE1_AI        0x20
+#define MODE1_SLEEP     0x10
+
+#define LED_FULL        0x10    /*!< bit 4 of LEDn_ON_H / LEDn_OFF_H */
+
+void pca9685_emu_power_on(pca9685_emu_t *chip)
+{
+    memset(chip, 0, sizeof(*chip));
+    chip->regs[REG_MODE1] = 0x11;
+    chip->regs[REG_MODE2] = 0x04;
+    chip->regs[REG_SUBADR1] = 0xE2;
+    chip->regs[REG_SUBADR2] = 0xE4;
+    chip->regs[REG_SUBADR3] = 0xE8;
+    chip->regs[REG_ALLCALLADR] = 0xE0;
+    for (int n = 0; n < 16; n++)
+        chip->regs[REG_LED0_ON_L + 4 * n + 3] = LED_FULL;
+    chip->regs[REG_PRE_SCALE] = 0x1E;
+}
+
+static void write_reg(pca9685_emu_t *chip, uint8_t reg, uint8_t value)
+{
+    uint8_t mode1 = chip->regs[REG_MODE1];
+
+    if (reg == REG_MODE1) {
+        uint8_t restart = mode1 & MODE1_RESTART;
+        if (value & MODE1_RESTART)
+            restart = 0;            // writing 1 clears it
+        else if ((value & MODE1_SLEEP) && !(mode1 & MODE1_SLEEP))
+            restart = MODE1_RESTART;    // PWM was running when put to sleep
+        chip->regs[REG_MODE1] = (value & ~MODE1_RESTART) | restart;
+    } else if (reg <= REG_LED15_OFF_H) {
+        chip->regs[reg] = value;
+        if (reg >= REG_LED0_ON_L) chip->led_writes++;
+    } else if (reg >= REG_ALL_LED_ON_L && reg <= REG_ALL_LED_OFF_H) {
+        for (int n = 0; n < 16; n++)
+            chip->regs[REG_LED0_ON_L + 4 * n + (reg - REG_ALL_LED_ON_L)] = value;
+        chip->led_writes++;
+    } else if (reg == REG_PRE_SCALE) {
+        if (mode1 & MODE1_SLEEP)
+            chip->regs[REG_PRE_SCALE] = value < 3 ? 3 : value;
+        else
+            chip->prescale_ignored++;
+    } else if (reg == 0xFF) {
+        chip->regs[reg] = value;    // TestMode, never touched by the driver
+    } else {
+        chip->reserved_writes++;
+    }
+}
+
+static uint8_t read_reg(const pca9685_emu_t *chip, uint8_t reg)
+{
+    if (reg > REG_LED15_OFF_H && reg < REG_PRE_SCALE)
+        return 0;   // reserved and ALL_LED_*
+    return chip->regs[reg];
+}
+
+static void advance(pca9685_emu_t *chip)
+{
+    if (!(chip->regs[REG_MODE1] & MODE1_AI))
+        return;
+    chip->pointer = chip->pointer == REG_LED15_OFF_H ? REG_MODE1 : (uint8_t)(chip->pointer + 1);
+}
+
+void pca9685_emu_write(pca9685_emu_t *chip, const uint8_t *data, size_t size)
+{
+    if (size == 0) return;
+
+    chip->pointer = data[0];
+    for (size_t i = 1; i < size; i++) {
+        write_reg(chip, chip->pointer, data[i]);
+        advance(chip);
+    }
+}
+
+void pca9685_emu_read(pca9685_emu_t *chip, uint8_t *data, size_t size)
+{
+    for (size_t i = 0; i < size; i++) {
+        data[i] = read_reg(chip, chip->pointer);
+        advance(chip);
+    }
+}
+
+pca9685_emu_output_t pca9685_emu_output(const pca9685_emu_t *chip, int channel, uint16_t *on, uint16_t *off)
+{
+    const uint8_t *led = &chip->regs[REG_LED0_ON_L + 4 * channel];
+    if (on) *on = led[0] | ((led[1] & 0x0F) << 8);
+    if (off) *off = led[2] | ((led[3] & 0x0F) << 8);
+
+    if (led[3] & LED_FULL) return PCA9685_EMU_FULL_OFF;
+    if (led[1] & LED_FULL) return PCA9685_EMU_FULL_ON;
+    return PCA9685_EMU_PWM;
+}
+
+float pca9685_emu_period_us(const pca9685_emu_t *chip)
+{
+    return (chip->regs[REG_PRE_SCALE] + 1) * 4096 / 25.0f;
+}
+
+uint64_t i2c_emu_transfer_ns(uint32_t scl_hz, size_t write_bytes, size_t read_bytes)
+{
+    // tHD;STA, tSU;STA, tSU;STO, tBUF minimums per speed class
+    uint32_t hd_sta, su_sta, su_sto, buf;
+    if (scl_hz <= 100000) {
+        hd_sta = 4000; su_sta = 4700; su_sto = 4000; buf = 4700;
+    } else if (scl_hz <= 400000) {
+        hd_sta = 600; su_sta = 600; su_sto = 600; buf = 1300;
+    } else {
+        hd_sta = 260; su_sta = 260; su_sto = 260; buf = 500;
+    }
+
+    uint64_t bit_ns = 1000000000ULL / scl_hz;
+    uint64_t ns = hd_sta + 9 * (1 + write_bytes) * bit_ns + su_sto + buf;
+    if (read_bytes)
+        ns += su_sta + hd_sta + 9 * (1 + read_bytes) * bit_ns;
+    return ns;
+}
@@ -19,6 +19,8 @@
 
 #include "pca9685.h"
 #include "web-server.h"
+#include "hexapod_start.h"
+#include "motion_link_uart.h"
 
 #include "led_strip.h" // to remove later
 static const char *TAG = "MAIN";
@@ -196,6 +198,11 @@ void app_main()
     //     ESP_LOGI(TAG, "Restarting loop...");
     //     vTaskDelay(1000 / portTICK_PERIOD_MS);
     // }
+    // stand up while Wi-Fi connects, the motion task runs on core 1
+    hexapod_start();
+#if CONFIG_HEXAPOD_LINK_ENABLE
+    ESP_ERROR_CHECK(motion_link_uart_start());
+#endif
     web_server_setup();
 
     // xTaskCreate(task_PCA9685, "task_PCA9685", 4096, NULL, 10, NULL);
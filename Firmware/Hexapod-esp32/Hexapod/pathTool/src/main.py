@@ -1,11 +1,14 @@
 import argparse
 import logging
+import math
 import os
 import sys
 
+import numpy as np
+
 import config
 import kinematics
-from path.lib import point_rotate_z, matrix_mul
+from path.lib import point_rotate_z, matrix_mul, get_rotate_x_matrix, get_rotate_y_matrix, get_rotate_z_matrix
 
 def collectPath(sub_folder):
     scripts = {}
@@ -71,7 +74,129 @@ def verify_path(path, params):
     return all_ok
 
 
-def generate_c_body(path, params):
+def table_points(params):
+    # world tip positions exactly as the generated C expressions evaluate them
+    # (offsets and matrix elements are rounded to 2 decimals on output)
+    data, mode, _, _ = params
+    points = []
+    if mode == "shift":
+        for i in range(len(data[0])):
+            points.append([[config.defaultPosition[j][k] + round(data[j][i][k], 2) for k in range(3)] for j in range(6)])
+    elif mode == "matrix":
+        for m in data:
+            e = [[round(m.item((r, c)), 2) for c in range(4)] for r in range(3)]
+            points.append([[sum(e[r][c]*config.defaultPosition[j][c] for c in range(3)) + e[r][3] for r in range(3)] for j in range(6)])
+    else:
+        raise RuntimeError("Generation mode: {} not supported".format(mode))
+    return points
+
+def to_leg_local(pt, leg):
+    # same rotation constants as Leg::translateToLocal in firmware
+    cs = {-45: (config.COS45, -config.SIN45), 0: (1, 0), 45: (config.COS45, config.SIN45),
+          135: (-config.COS45, config.SIN45), 180: (-1, 0), 225: (-config.COS45, -config.SIN45)}
+    c, s = cs[config.defaultAngle[leg]]
+    dx = pt[0] - config.mountPosition[leg][0]
+    dy = pt[1] - config.mountPosition[leg][1]
+    return [dx*c - dy*s, dx*s + dy*c, pt[2]]
+
+def generate_c_angles(path, params):
+    result = "const JointAngles {}_angles[] {{\n".format(path)
+    for locations in table_points(params):
+        result += "    {{" + ", ".join(
+            "{{{:.4f}, {:.4f}, {:.4f}}}".format(*kinematics.ik(to_leg_local(pt, j)))
+            for j, pt in enumerate(locations)
+        ) + "}},\n"
+    result += "};\n"
+    return result
+
+def matrix_to_pose(m):
+    # tip' = A * tip + b  ==  R^T * (tip - t), R = Rz(yaw) * Ry(pitch) * Rx(roll)
+    a = np.array(m)[:3, :3]
+    b = np.array(m)[:3, 3]
+    r = a.T
+    t = -r.dot(b)
+    roll = math.atan2(r[2][1], r[2][2])
+    pitch = math.asin(-r[2][0])
+    yaw = math.atan2(r[1][0], r[0][0])
+    return [math.degrees(roll), math.degrees(pitch), math.degrees(yaw), t[0], t[1], t[2]]
+
+def pose_to_matrix(pose):
+    roll, pitch, yaw = (math.radians(v) for v in pose[:3])
+    r = np.array(get_rotate_z_matrix(math.degrees(yaw)) * get_rotate_y_matrix(math.degrees(pitch)) * get_rotate_x_matrix(math.degrees(roll)))[:3, :3]
+    m = np.identity(4)
+    m[:3, :3] = r.T
+    m[:3, 3] = -r.T.dot(pose[3:])
+    return m
+
+def tangent(before, after):
+    # Catmull-Rom tangent limited as Fritsch-Carlson, same as Movement::next
+    if before * after <= 0:
+        return 0
+    m = (before + after) * 0.5
+    limit = 3 * (before if abs(before) < abs(after) else after)
+    return limit if abs(m) > abs(limit) else m
+
+def hermite(p0, p1, p2, p3, t):
+    t2, t3 = t*t, t*t*t
+    d = p2 - p1
+    return (2*t3 - 3*t2 + 1)*p1 + (t3 - 2*t2 + t)*tangent(p1 - p0, d) + (-2*t3 + 3*t2)*p2 + (t3 - t2)*tangent(d, p3 - p2)
+
+def sparse_params(params, step, offset):
+    # every step-th keyframe from offset on, each played step times longer;
+    # an entry moves to the first kept keyframe at or after it
+    data, mode, dur, entries = params
+    count = len(data[0])
+    keys = [(list(d)[offset:] + list(d)[:offset])[::step] for d in data]
+    return keys, mode, dur*step, tuple(((e - offset) % count + step - 1) // step % (count // step) for e in entries)
+
+def spline_deviation(params, step, offset=0):
+    # max distance (mm) from the dense keyframes of the spline through every
+    # step-th of them, starting at offset
+    dense = table_points(params)
+    dense = dense[offset:] + dense[:offset]
+    keys = dense[::step]
+    n = len(keys)
+    worst = 0
+    for i, locations in enumerate(dense):
+        seg, t = divmod(i, step)
+        if t == 0:
+            continue
+        p = [keys[(seg + k) % n] for k in (-1, 0, 1, 2)]
+        for j, pt in enumerate(locations):
+            curve = [hermite(p[0][j][k], p[1][j][k], p[2][j][k], p[3][j][k], t / step) for k in range(3)]
+            worst = max(worst, math.dist(curve, pt))
+    return worst
+
+def sparsify(path, params, max_step, tolerance):
+    # largest decimation whose spline stays within tolerance of the dense path,
+    # for location tables only
+    data, mode, _, _ = params
+    if mode != "shift":
+        return params, 1
+    count = len(data[0])
+    for step in range(max_step, 1, -1):
+        if count % step:
+            continue
+        deviation, offset = min((spline_deviation(params, step, offset), offset) for offset in range(step))
+        if deviation <= tolerance:
+            print("{}: {} -> {} keyframes, deviation {:.2f}mm".format(path, count, count // step, deviation))
+            return sparse_params(params, step, offset), step
+        print("{}: 1/{} deviates {:.2f}mm, skipped".format(path, step, deviation))
+    return params, 1
+
+def generate_c_poses(path, params):
+    data, _, dur, entries = params
+    result = "\nconst BodyPose {}_poses[] {{\n".format(path)
+    for m in data:
+        pose = matrix_to_pose(m)
+        assert(np.max(np.abs(pose_to_matrix(pose) - np.array(m))) < 1e-9)
+        result += "    {" + ", ".join("{:.4f}".format(round(v, 4) + 0.0) for v in pose) + "},\n"
+    result += "};\n"
+    result += "const int {}_entries[] {{ {} }};\n".format(path, ",".join(str(e) for e in entries))
+    result += "const MovementTable {name}_table {{nullptr, {count}, {dur}, {name}_entries, {ecount}, nullptr, {name}_poses, false, nullptr }};".format(name=path, count=len(data), dur=dur, ecount=len(entries))
+    return result
+
+def generate_c_body(path, params, angles=False, spline=False):
     data, mode, dur, entries = params
     result = "\nconst Locations {}_paths[] {{\n".format(path)
 
@@ -88,25 +213,71 @@ def generate_c_body(path, params):
             ) + "},\n"
 
     elif mode == "matrix":
-        # data: np.matrix[N]
-
-        count = len(data)
-        for i in range(count):
-            result += "    {" + ", \n     ".join(
-                "{{P{idx}X*{e00:.2f} + P{idx}Y*{e01:.2f} + P{idx}Z*{e02:.2f} + {e03:.2f}, P{idx}X*{e10:.2f} + P{idx}Y*{e11:.2f} + P{idx}Z*{e12:.2f} + {e13:.2f}, P{idx}X*{e20:.2f} + P{idx}Y*{e21:.2f} + P{idx}Z*{e22:.2f} + {e23:.2f}}}".format(
-                    e00=data[i].item((0,0)), e01=data[i].item((0,1)), e02=data[i].item((0,2)), e03=data[i].item((0,3)),
-                    e10=data[i].item((1,0)), e11=data[i].item((1,1)), e12=data[i].item((1,2)), e13=data[i].item((1,3)),
-                    e20=data[i].item((2,0)), e21=data[i].item((2,1)), e22=data[i].item((2,2)), e23=data[i].item((2,3)),
-                    idx=j+1) 
-                for j in range(6)
-            ) + "},\n"
+        # data: np.matrix[N], emitted as runtime BodyPose keyframes over the standby stance
+        return generate_c_poses(path, params)
 
     else:
         raise RuntimeError("Generation mode: {} not supported".format(mode))
 
     result += "};\n"
     result += "const int {}_entries[] {{ {} }};\n".format(path, ",".join(str(e) for e in entries))
-    result += "const MovementTable {name}_table {{{name}_paths, {count}, {dur}, {name}_entries, {ecount} }};".format(name=path, count=count, dur=dur, ecount=len(entries))
+    if angles:
+        result += generate_c_angles(path, params)
+    # every field spelled out, none left to -Wmissing-field-initializers
+    result += "const MovementTable {name}_table {{{name}_paths, {count}, {dur}, {name}_entries, {ecount}, {angles}, nullptr, {spline}, nullptr }};".format(
+        name=path, count=count, dur=dur, ecount=len(entries),
+        angles="{}_angles".format(path) if angles else "nullptr", spline="true" if spline else "false")
+    return result
+
+def compact_tracks(data):
+    # offsets in 0.01 mm, one track per distinct leg path: a leg replays a
+    # track already taken when it only differs in phase
+    count = len(data[0])
+    tracks, track, phase = [], [], []
+    for leg in data:
+        keys = [tuple(int(round(v * 100)) for v in pt) for pt in leg]
+        assert(all(-32768 <= v <= 32767 for pt in keys for v in pt))
+        match = next(((t, p) for t, keyframes in enumerate(tracks) for p in range(count)
+                      if keyframes[p:] + keyframes[:p] == keys), None)
+        if match is None:
+            match = (len(tracks), 0)
+            tracks.append(keys)
+        track.append(match[0])
+        phase.append(match[1])
+    return tracks, track, phase
+
+def generate_c_stance():
+    # the stance every compact track is offset from
+    return "const float compact_stance[6][3] {\n" + "".join(
+        "    {{P{idx}X, P{idx}Y, P{idx}Z}},\n".format(idx=j+1) for j in range(6)) + "};"
+
+def generate_c_compact(path, params, angles=False, spline=False):
+    data, mode, dur, entries = params
+    if mode != "shift" or len(data[0]) < 2:
+        return generate_c_body(path, params, angles, spline)
+
+    count = len(data[0])
+    tracks, track, phase = compact_tracks(data)
+    result = "\nconst int16_t {}_tracks[][3] {{\n".format(path)
+    for keys in tracks:
+        result += "".join("    {{{}, {}, {}}},\n".format(*pt) for pt in keys)
+    result += "};\n"
+    result += "const int {}_entries[] {{ {} }};\n".format(path, ",".join(str(e) for e in entries))
+    if angles:
+        # the decoded keyframes, solved as the firmware will see them
+        points = [[[config.defaultPosition[j][k] + keys[(i + phase[j]) % count][k] / 100 for k in range(3)]
+                   for j, keys in enumerate(tracks[t] for t in track)] for i in range(count)]
+        result += "const int16_t {}_joints[][18] {{\n".format(path)
+        for locations in points:
+            result += "    {" + ", ".join(
+                "{}".format(int(round(a * 100))) for j, pt in enumerate(locations) for a in kinematics.ik(to_leg_local(pt, j))
+            ) + "},\n"
+        result += "};\n"
+    result += "const CompactTable {name}_compact {{{name}_tracks, {{{track}}}, {{{phase}}}, compact_stance, {joints} }};\n".format(
+        name=path, track=", ".join(str(t) for t in track), phase=", ".join(str(p) for p in phase),
+        joints="{}_joints".format(path) if angles else "nullptr")
+    result += "const MovementTable {name}_table {{nullptr, {count}, {dur}, {name}_entries, {ecount}, nullptr, nullptr, {spline}, &{name}_compact }};".format(
+        name=path, count=count, dur=dur, ecount=len(entries), spline="true" if spline else "false")
     return result
 
 def generate_c_def(path):
@@ -120,6 +291,14 @@ if __name__ == '__main__':
                         help='path script directory (default: {})'.format('path'))
     parser.add_argument('--outPath', metavar='PATH',  dest='out_path', default='output/movement_table.h',
                         help='path script directory (default: {})'.format('output/movement_table.h'))
+    parser.add_argument('--angles', action='store_true', dest='angles',
+                        help='also emit pre-solved joint angles for each keyframe')
+    parser.add_argument('--sparse', metavar='N', dest='sparse', type=int, default=1,
+                        help='keep up to every N-th keyframe of gait paths, played back as a spline (default: 1, dense)')
+    parser.add_argument('--tolerance', metavar='MM', dest='tolerance', type=float, default=2.0,
+                        help='max deviation of a sparse spline from the dense path (default: 2.0)')
+    parser.add_argument('--compact', action='store_true', dest='compact',
+                        help='emit gait paths as int16 offsets (0.01 mm) from the stance, legs sharing a path as phase offsets')
     args = parser.parse_args()
 
     sys.path.insert(0, args.path_dir)
@@ -141,9 +320,14 @@ if __name__ == '__main__':
             print("//", file=f)
             print("// This file is generated, dont directly modify content...", file=f)
             print("//", file=f)
+            print("#include \"base.h\" ", file=f)
             print("namespace {", file=f)
+            if args.compact:
+                print(generate_c_stance(), file=f)
             for path, data in results.items():
-                print(generate_c_body(path, data), file=f)
+                data, step = sparsify(path, data, args.sparse, args.tolerance)
+                generate = generate_c_compact if args.compact else generate_c_body
+                print(generate(path, data, args.angles, step > 1), file=f)
             print("}\n", file=f)
             for path in results:
                 print(generate_c_def(path), file=f)
@@ -0,0 +1,2 @@
+def path_generator():
+    return [[(0, 0, 0)]]*6, "shift", 20, (0,)
@@ -0,0 +1,130 @@
+import argparse
+import math
+
+import numpy as np
+
+import config
+import kinematics
+
+# Reachability grid of one leg, in the vertical plane of the leg:
+#   r: horizontal distance from joint 2 (femur axis), z: height of the tip
+# Hip yaw does not change r/z, it is checked analytically on the target.
+
+g_cell = 3.0
+g_margin = 6.0
+g_samples = 9     # per cell edge, thin corners of the workspace need the density
+
+STATE_OUTSIDE = 0
+STATE_INSIDE = 1
+STATE_BOUNDARY = 2
+
+def feasible(r, z):
+    if r < -config.kLegJoint1ToJoint2:
+        # behind the hip axis, r = hypot(x, y) - kLegJoint1ToJoint2 never gets here
+        return False
+
+    pt = (config.kLegRootToJoint1 + config.kLegJoint1ToJoint2 + r, 0, z)
+    try:
+        angles = kinematics.ik(pt)
+    except (ValueError, ZeroDivisionError):
+        # acos domain error (out of reach) or tip on the femur axis
+        return False
+
+    for i in (1, 2):
+        if angles[i] < config.angleLimitation[i][0] or angles[i] > config.angleLimitation[i][1]:
+            return False
+    return True
+
+def workspace_bounds():
+    rs, zs = [], []
+    (a1min, a1max), (a2min, a2max) = config.angleLimitation[1], config.angleLimitation[2]
+    for a1 in np.linspace(a1min, a1max, 121):
+        for a2 in np.linspace(a2min, a2max, 121):
+            t1 = math.radians(a1)
+            t2 = math.radians(a1 + a2 - 90)
+            rs.append(math.cos(t1)*config.kLegJoint2ToJoint3 + math.cos(t2)*config.kLegJoint3ToTip)
+            zs.append(math.sin(t1)*config.kLegJoint2ToJoint3 + math.sin(t2)*config.kLegJoint3ToTip)
+    return min(rs), max(rs), min(zs), max(zs)
+
+def build_grid():
+    rmin, rmax, zmin, zmax = workspace_bounds()
+    origin_r = math.floor((rmin - g_margin) / g_cell) * g_cell
+    origin_z = math.floor((zmin - g_margin) / g_cell) * g_cell
+    cols = int(math.ceil((rmax + g_margin - origin_r) / g_cell))
+    rows = int(math.ceil((zmax + g_margin - origin_z) / g_cell))
+
+    # feasibility on a g_samples x g_samples lattice per cell, edges shared
+    n = g_samples - 1
+    step = g_cell / n
+    lattice = [[feasible(origin_r + c*step, origin_z + r*step) for c in range(cols*n + 1)] for r in range(rows*n + 1)]
+
+    states = []
+    for row in range(rows):
+        for col in range(cols):
+            pts = [lattice[row*n + i][col*n + j] for i in range(g_samples) for j in range(g_samples)]
+            if all(pts):
+                states.append(STATE_INSIDE)
+            elif not any(pts):
+                states.append(STATE_OUTSIDE)
+            else:
+                states.append(STATE_BOUNDARY)
+
+    # nearest inside cell (by center distance) for every cell
+    idx = np.arange(rows*cols)
+    centers = np.stack([idx % cols, idx // cols], axis=1).astype(float)
+    inside = idx[np.array(states) == STATE_INSIDE]
+    nearest = []
+    for i in range(rows*cols):
+        if states[i] == STATE_INSIDE:
+            nearest.append(i)
+        else:
+            d = np.sum((centers[inside] - centers[i])**2, axis=1)
+            nearest.append(int(inside[np.argmin(d)]))
+
+    return origin_r, origin_z, cols, rows, states, nearest
+
+def generate_c(origin_r, origin_z, cols, rows, states, nearest):
+    assert(config.angleLimitation[0][0] == -config.angleLimitation[0][1])
+    assert(rows*cols < 65536)
+
+    packed = []
+    for i in range(0, len(states), 4):
+        b = 0
+        for j, s in enumerate(states[i:i+4]):
+            b |= s << (2*j)
+        packed.append(b)
+
+    result = "//\n// This file is generated, dont directly modify content...\n//\n"
+    result += "// leg reach grid: {}x{} cells of {:.1f} mm, {} inside, {} boundary\n".format(
+        cols, rows, g_cell, states.count(STATE_INSIDE), states.count(STATE_BOUNDARY))
+    result += "constexpr float kReachCell = {:.1f}f;\n".format(g_cell)
+    result += "constexpr float kReachOriginR = {:.1f}f;\n".format(origin_r)
+    result += "constexpr float kReachOriginZ = {:.1f}f;\n".format(origin_z)
+    result += "constexpr int kReachCols = {};\n".format(cols)
+    result += "constexpr int kReachRows = {};\n".format(rows)
+    result += "constexpr float kReachYawTan = {:.6f}f;\n".format(math.tan(math.radians(config.angleLimitation[0][1])))
+    result += "constexpr float kJointLimits[3][2] {{ {} }};\n".format(
+        ", ".join("{{{}, {}}}".format(lo, hi) for lo, hi in config.angleLimitation))
+    result += "\n// 2 bits per cell, row major from (origin r, origin z): 0 outside, 1 inside, 2 boundary\n"
+    result += "const uint8_t kReachState[] {\n"
+    for i in range(0, len(packed), 24):
+        result += "    " + ", ".join("0x{:02x}".format(b) for b in packed[i:i+24]) + ",\n"
+    result += "};\n"
+    result += "\n// nearest inside cell of every cell\n"
+    result += "const uint16_t kReachNearest[] {\n"
+    for i in range(0, len(nearest), 16):
+        result += "    " + ", ".join(str(n) for n in nearest[i:i+16]) + ",\n"
+    result += "};\n"
+    return result
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser(description='reach: generate leg reachability grid')
+    parser.add_argument('--outPath', metavar='PATH',  dest='out_path', default='output/reach_grid.h',
+                        help='output header (default: {})'.format('output/reach_grid.h'))
+    args = parser.parse_args()
+
+    grid = build_grid()
+    with open(args.out_path, "w") as f:
+        f.write(generate_c(*grid))
+
+    print("Result written to {}".format(args.out_path))
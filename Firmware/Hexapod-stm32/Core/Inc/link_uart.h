@@ -0,0 +1,51 @@
+/**
+  ******************************************************************************
+  * @file    link_uart.h
+  * @brief   STM32 end of the ESP32 motion link (motion_link.h) on USART3:
+  *          DMA reception into a ring buffer cut at line idle, frames decoded
+  *          from the main loop, replies queued and sent by DMA.
+  ******************************************************************************
+  */
+#ifndef __LINK_UART_H__
+#define __LINK_UART_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+#include "motion_link.h"
+
+#define LINK_RX_RING_SIZE   512     /* 9 ms of line at 921600 baud */
+#define LINK_TX_SLOTS       4       /* frames queued behind the one on the wire */
+
+typedef struct
+{
+  motion_link_stats_t Rx;
+  uint32_t UartErrors;    /*!< overrun, noise or framing errors, reception restarted */
+  uint32_t TxFrames;
+  uint32_t TxDropped;     /*!< Link_Send() with every slot taken */
+} Link_StatsTypeDef;
+
+/**
+  * @brief  Start the circular RX DMA on `huart`, which must have its RX and TX
+  *         DMA streams linked (MX_USART3_UART_Init()).
+  */
+HAL_StatusTypeDef Link_Init(UART_HandleTypeDef *huart);
+
+/**
+  * @brief  Decode everything received since the last call, `handler` runs here
+  *         once per good frame. Returns the number of frames.
+  */
+uint32_t Link_Poll(motion_link_handler_t handler, void *ctx);
+
+/** @brief Frame a message with the next seq and queue it for the TX DMA. */
+HAL_StatusTypeDef Link_Send(uint8_t type, const void *payload, uint8_t len);
+
+void Link_GetStats(Link_StatsTypeDef *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __LINK_UART_H__ */
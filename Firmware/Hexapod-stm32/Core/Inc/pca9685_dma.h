@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    pca9685_dma.h
+  * @brief   Non-blocking PCA9685 servo driver: whole-board frames written with
+  *          one auto-increment DMA transfer each, completion by callback.
+  ******************************************************************************
+  */
+#ifndef __PCA9685_DMA_H__
+#define __PCA9685_DMA_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "main.h"
+
+#define PCA9685_DMA_CHANNELS     16
+#define PCA9685_DMA_FRAME_SIZE   (4 * PCA9685_DMA_CHANNELS)  /* LED0_ON_L..LED15_OFF_H */
+#define PCA9685_DMA_MAX_BOARDS   4
+
+typedef struct PCA9685_DMA_HandleTypeDef PCA9685_DMA_HandleTypeDef;
+
+/* Called from the I2C/DMA interrupt once a frame is on the chip (HAL_OK) or failed */
+typedef void (*PCA9685_DMA_CallbackTypeDef)(PCA9685_DMA_HandleTypeDef *hpca, HAL_StatusTypeDef status);
+
+/*
+ * Handles hold the DMA source buffer, keep them in AXI SRAM (the default RAM
+ * region), DMA1 cannot reach the DTCM.
+ */
+struct PCA9685_DMA_HandleTypeDef
+{
+  I2C_HandleTypeDef *hi2c;
+  uint16_t Address;                              /*!< 8-bit HAL address */
+  uint8_t Mode1;                                 /*!< MODE1 as last written, the chip is never read back */
+  PCA9685_DMA_CallbackTypeDef FrameDoneCallback; /*!< optional */
+
+  uint8_t Stage[PCA9685_DMA_FRAME_SIZE];         /*!< frame being built by PCA9685_DMA_SetPWM() */
+  uint8_t Next[PCA9685_DMA_FRAME_SIZE];          /*!< committed, waiting for the bus */
+  uint8_t Tx[PCA9685_DMA_FRAME_SIZE];            /*!< on the bus, read by the DMA */
+  volatile uint8_t Pending;
+  volatile uint8_t InFlight;
+
+  volatile uint32_t FramesWritten;
+  volatile uint32_t FramesMerged;                /*!< committed over a frame still pending */
+  volatile uint32_t Errors;
+};
+
+/**
+  * @brief  Set up a board: MODE1, PRE_SCALE and auto-increment in three blocking
+  *         writes, all channels staged full off. Call before the board's bus
+  *         is used for DMA frames.
+  * @param  address 7-bit I2C address
+  */
+HAL_StatusTypeDef PCA9685_DMA_Init(PCA9685_DMA_HandleTypeDef *hpca, I2C_HandleTypeDef *hi2c, uint8_t address, uint16_t frequency);
+
+/** @brief PRE_SCALE value for `frequency` per the datasheet formula (page 25/52). */
+uint8_t PCA9685_DMA_Prescale(uint16_t frequency);
+
+/**
+  * @brief  Change the PWM frequency, blocking, only while no frame is queued.
+  *         The next committed frame rewrites every LEDn register and restarts
+  *         the outputs, the RESTART sequence and its 500 us wait are not needed.
+  */
+HAL_StatusTypeDef PCA9685_DMA_SetPWMFrequency(PCA9685_DMA_HandleTypeDef *hpca, uint16_t frequency);
+
+/** @brief Stage one channel of the next frame, nothing goes on the bus. */
+void PCA9685_DMA_SetPWM(PCA9685_DMA_HandleTypeDef *hpca, uint8_t channel, uint16_t on, uint16_t off);
+
+/**
+  * @brief  Queue the staged frame and return. Boards sharing a bus are written
+  *         one after the other from the transfer complete interrupt. A frame
+  *         committed while the previous one is still queued replaces it.
+  */
+HAL_StatusTypeDef PCA9685_DMA_Commit(PCA9685_DMA_HandleTypeDef *hpca);
+
+/** @brief 1 while a committed frame has not reached the chip yet. */
+uint8_t PCA9685_DMA_IsBusy(const PCA9685_DMA_HandleTypeDef *hpca);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PCA9685_DMA_H__ */
@@ -0,0 +1,155 @@
+/**
+  ******************************************************************************
+  * @file    link_uart.c
+  * @brief   USART3 transport of the motion link, see link_uart.h.
+  *
+  *          The RX DMA runs circular over rxRing and never stops. The HAL
+  *          reports its write position on line idle and at half and full
+  *          ring, so a frame is seen one idle character after its last byte
+  *          without an interrupt per byte. Only the main loop decodes.
+  ******************************************************************************
+  */
+#include <string.h>
+#include "link_uart.h"
+
+static UART_HandleTypeDef *link;
+
+/* DMA buffers, AXI SRAM like the rest of .bss (see pca9685_dma.h) */
+static uint8_t rxRing[LINK_RX_RING_SIZE];
+static uint8_t txSlot[LINK_TX_SLOTS][MOTION_LINK_MAX_FRAME];
+static uint8_t txSize[LINK_TX_SLOTS];
+
+static volatile uint16_t rxHead;        /* DMA write position */
+static volatile uint8_t rxRestarted;
+static uint16_t rxTail;
+static motion_link_decoder_t decoder;
+
+static volatile uint8_t txFirst;        /* slot on the wire, or next to go */
+static volatile uint8_t txCount;
+static uint8_t txSeq;
+
+static volatile uint32_t uartErrors;
+static uint32_t txFrames;
+static uint32_t txDropped;
+
+static HAL_StatusTypeDef StartReceive(void)
+{
+  HAL_StatusTypeDef status = HAL_UARTEx_ReceiveToIdle_DMA(link, rxRing, LINK_RX_RING_SIZE);
+  rxHead = 0;
+  rxRestarted = 1;
+  return status;
+}
+
+/* Must run with interrupts off or from the UART interrupt */
+static void StartTransmit(void)
+{
+  if (txCount && HAL_UART_Transmit_DMA(link, txSlot[txFirst], txSize[txFirst]) != HAL_OK)
+  {
+    // drop it rather than wedge the queue
+    txFirst = (txFirst + 1) % LINK_TX_SLOTS;
+    txCount--;
+    txDropped++;
+  }
+}
+
+HAL_StatusTypeDef Link_Init(UART_HandleTypeDef *huart)
+{
+  link = huart;
+  motion_link_decoder_init(&decoder);
+  txFirst = txCount = 0;
+  return StartReceive();
+}
+
+uint32_t Link_Poll(motion_link_handler_t handler, void *ctx)
+{
+  uint32_t frames = 0;
+
+  if (rxRestarted)
+  {
+    // the ring starts over at 0, whatever was half received is gone
+    rxRestarted = 0;
+    rxTail = 0;
+    decoder.hunting = true;
+    decoder.pos = 0;
+  }
+
+  uint16_t head = rxHead;
+  while (rxTail != head)
+  {
+    uint16_t end = head > rxTail ? head : LINK_RX_RING_SIZE;
+    frames += motion_link_decode(&decoder, &rxRing[rxTail], end - rxTail, handler, ctx);
+    rxTail = end % LINK_RX_RING_SIZE;
+  }
+  return frames;
+}
+
+HAL_StatusTypeDef Link_Send(uint8_t type, const void *payload, uint8_t len)
+{
+  uint8_t frame[MOTION_LINK_MAX_FRAME];
+  HAL_StatusTypeDef status = HAL_OK;
+
+  size_t size = motion_link_encode(frame, txSeq, type, payload, len);
+  if (!size)
+    return HAL_ERROR;
+
+  __disable_irq();
+  if (txCount == LINK_TX_SLOTS)
+  {
+    txDropped++;
+    status = HAL_BUSY;
+  }
+  else
+  {
+    uint8_t slot = (txFirst + txCount) % LINK_TX_SLOTS;
+    memcpy(txSlot[slot], frame, size);
+    txSize[slot] = size;
+    txSeq++;
+    txFrames++;
+    if (txCount++ == 0)
+      StartTransmit();
+  }
+  __enable_irq();
+
+  return status;
+}
+
+void Link_GetStats(Link_StatsTypeDef *stats)
+{
+  stats->Rx = decoder.stats;
+  stats->UartErrors = uartErrors;
+  stats->TxFrames = txFrames;
+  stats->TxDropped = txDropped;
+}
+
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
+{
+  if (huart != link)
+    return;
+
+  // Size is the DMA position in the ring, LINK_RX_RING_SIZE at wrap
+  rxHead = Size % LINK_RX_RING_SIZE;
+}
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef *huart)
+{
+  if (huart != link)
+    return;
+
+  txFirst = (txFirst + 1) % LINK_TX_SLOTS;
+  txCount--;
+  StartTransmit();
+}
+
+void HAL_UART_ErrorCallback(UART_HandleTypeDef *huart)
+{
+  if (huart != link)
+    return;
+
+  uartErrors++;
+  // a blocking error aborts the RX DMA, restart it; a TX in flight is aborted
+  // too and its slot retried
+  if (huart->RxState == HAL_UART_STATE_READY)
+    StartReceive();
+  if (txCount && huart->gState == HAL_UART_STATE_READY)
+    StartTransmit();
+}
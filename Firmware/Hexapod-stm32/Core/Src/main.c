@@ -18,13 +18,18 @@
 /* USER CODE END Header */
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
+#include "dma.h"
 #include "i2c.h"
+#include "tim.h"
 #include "usart.h"
 #include "gpio.h"
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include <string.h>
 #include "driver_pca9685_basic.h"
+#include "link_uart.h"
+#include "motion.h"
 
 /* USER CODE END Includes */
 
@@ -46,6 +51,7 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
+static uint8_t linkAckSeq;
 
 /* USER CODE END PV */
 
@@ -53,72 +59,14 @@
 void SystemClock_Config(void);
 static void MPU_Config(void);
 /* USER CODE BEGIN PFP */
+static void Link_OnMessage(const motion_link_msg_t *msg, void *ctx);
+static void Link_SendTelemetry(void);
 
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
 /* USER CODE BEGIN 0 */
-#define PCA9685_ADDRESS       (0x40 << 1) // HAL uses 8-bit address (shifted)
-// Datasheet link --> https://cdn-shop.adafruit.com/datasheets/PCA9685.pdf
-#define PCA9685_MODE1         0x0         // as in the datasheet page no 10/52
-#define PCA9685_PRE_SCALE     0xFE        // as in the datasheet page no 13/52
-#define PCA9685_LED0_ON_L     0x6         // as in the datasheet page no 10/52
-#define PCA9685_MODE1_SLEEP_BIT      4    // as in the datasheet page no 14/52
-#define PCA9685_MODE1_AI_BIT         5    // as in the datasheet page no 14/52
-#define PCA9685_MODE1_RESTART_BIT    7    // as in the datasheet page no 14/52
-
-void PCA9685_SetBit(uint8_t Register, uint8_t Bit, uint8_t Value)
-{
-  uint8_t readValue;
-  // Read all 8 bits and set only one bit to 0/1 and write all 8 bits back
-  HAL_I2C_Mem_Read(&hi2c2, PCA9685_ADDRESS, Register, 1, &readValue, 1, 10);
-  if (Value == 0) readValue &= ~(1 << Bit);
-  else readValue |= (1 << Bit);
-  HAL_I2C_Mem_Write(&hi2c2, PCA9685_ADDRESS, Register, 1, &readValue, 1, 10);
-  HAL_Delay(1);
-}
-
-void PCA9685_SetPWMFrequency(uint16_t frequency)
-{
-  uint8_t prescale;
-  if(frequency >= 1526) prescale = 0x03;
-  else if(frequency <= 24) prescale = 0xFF;
-  //  internal 25 MHz oscillator as in the datasheet page no 1/52
-  else prescale = 25000000 / (4096 * frequency);
-  // prescale changes 3 to 255 for 1526Hz to 24Hz as in the datasheet page no 1/52
-  PCA9685_SetBit(PCA9685_MODE1, PCA9685_MODE1_SLEEP_BIT, 1);
-  HAL_I2C_Mem_Write(&hi2c2, PCA9685_ADDRESS, PCA9685_PRE_SCALE, 1, &prescale, 1, 10);
-  PCA9685_SetBit(PCA9685_MODE1, PCA9685_MODE1_SLEEP_BIT, 0);
-  PCA9685_SetBit(PCA9685_MODE1, PCA9685_MODE1_RESTART_BIT, 1);
-}
-
-void PCA9685_Init(uint16_t frequency)
-{
-  PCA9685_SetPWMFrequency(frequency); // 50 Hz for servo
-  PCA9685_SetBit(PCA9685_MODE1, PCA9685_MODE1_AI_BIT, 1);
-}
-
-void PCA9685_SetPWM(uint8_t Channel, uint16_t OnTime, uint16_t OffTime)
-{
-  uint8_t registerAddress;
-  uint8_t pwm[4];
-  registerAddress = PCA9685_LED0_ON_L + (4 * Channel);
-  // See example 1 in the datasheet page no 18/52
-  pwm[0] = OnTime & 0xFF;
-  pwm[1] = OnTime>>8;
-  pwm[2] = OffTime & 0xFF;
-  pwm[3] = OffTime>>8;
-  HAL_I2C_Mem_Write(&hi2c2, PCA9685_ADDRESS, registerAddress, 1, pwm, 4, 10);
-}
 
-void PCA9685_SetServoAngle(uint8_t Channel, float Angle)
-{
-  float Value;
-  // 50 Hz servo then 4095 Value --> 20 milliseconds
-  // 0 degree --> 0.5 ms(102.4 Value) and 180 degree --> 2.5 ms(511.9 Value)
-  Value = (Angle * (511.9 - 102.4) / 180.0) + 102.4;
-  PCA9685_SetPWM(Channel, 0, (uint16_t)Value);
-}
 /* USER CODE END 0 */
 
 /**
@@ -153,11 +101,22 @@ int main(void)
 
   /* Initialize all configured peripherals */
   MX_GPIO_Init();
+  MX_DMA_Init();
   MX_USART3_UART_Init();
   MX_I2C2_Init();
+  MX_TIM6_Init();
   /* USER CODE BEGIN 2 */
 
-  PCA9685_Init(50); // 50Hz for servo
+  // servo boards and standby pose, then the control tick runs the gait from TIM6
+  Motion_Init();
+  Motion_Start();
+
+  // commands from the ESP32 over USART3, telemetry back every tick
+  if (Link_Init(&huart3) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  uint32_t telemetryTick = HAL_GetTick();
 
   /* USER CODE END 2 */
 
@@ -165,13 +124,13 @@ int main(void)
   /* USER CODE BEGIN WHILE */
   while (1)
   {
-//      PCA9685_SetServoAngle(0, 0);
-//      PCA9685_SetServoAngle(15, 0);
-//      HAL_Delay(2000);
-//      PCA9685_SetServoAngle(0, 90);
-//      PCA9685_SetServoAngle(15, 90 );
-//      HAL_Delay(2000);
+    Link_Poll(Link_OnMessage, NULL);
 
+    if (HAL_GetTick() - telemetryTick >= MOTION_TICK_MS)
+    {
+      telemetryTick += MOTION_TICK_MS;
+      Link_SendTelemetry();
+    }
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -242,7 +201,84 @@ void SystemClock_Config(void)
 }
 
 /* USER CODE BEGIN 4 */
+static void Link_OnMessage(const motion_link_msg_t *msg, void *ctx)
+{
+  switch (msg->type)
+  {
+  case MOTION_LINK_PING:
+    Link_Send(MOTION_LINK_PONG, msg->payload, msg->len);
+    return;
+
+  case MOTION_LINK_MODE:
+    if (msg->len != sizeof(motion_link_mode_t))
+      return;
+    Motion_SetMode(msg->payload[0]);
+    break;
 
+  case MOTION_LINK_SPEED:
+  {
+    motion_link_speed_t speed;
+    if (msg->len != sizeof(speed))
+      return;
+    memcpy(&speed, msg->payload, sizeof(speed));
+    Motion_SetSpeed(speed.speed);
+    break;
+  }
+
+  case MOTION_LINK_POSE:
+  {
+    motion_link_pose_t pose;
+    if (msg->len != sizeof(pose))
+      return;
+    memcpy(&pose, msg->payload, sizeof(pose));
+    Motion_SetBodyPose(pose.roll, pose.pitch, pose.yaw, pose.x, pose.y, pose.z);
+    break;
+  }
+
+  case MOTION_LINK_FRAME:
+  {
+    motion_link_frame_t frame;
+    float angles[18];
+    if (msg->len != sizeof(frame))
+      return;
+    memcpy(&frame, msg->payload, sizeof(frame));
+    for (int i = 0; i < 18; i++)
+      angles[i] = frame.angle[i] * 0.01f;
+    Motion_SetJoints(angles);
+    break;
+  }
+
+  default:
+    return;
+  }
+  linkAckSeq = msg->seq;
+}
+
+static void Link_SendTelemetry(void)
+{
+  Motion_StatsTypeDef motion;
+  Link_StatsTypeDef link;
+  motion_link_telemetry_t t;
+
+  Motion_GetStats(&motion);
+  Link_GetStats(&link);
+  t.ticks = motion.Ticks;
+  t.overruns = motion.Overruns;
+  t.max_cycles = motion.MaxCycles;
+  t.mode = motion.Mode;
+  t.ack_seq = linkAckSeq;
+  t.rx_errors = (uint16_t)(link.Rx.crc_errors + link.Rx.len_errors);
+  t.rx_lost = (uint16_t)link.Rx.lost;
+  Link_Send(MOTION_LINK_TELEMETRY, &t, sizeof(t));
+}
+
+void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim)
+{
+  if (htim->Instance == TIM6)
+  {
+    Motion_Tick();
+  }
+}
 /* USER CODE END 4 */
 
  /* MPU Configuration */
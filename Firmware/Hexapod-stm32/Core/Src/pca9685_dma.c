@@ -0,0 +1,175 @@
+/**
+  ******************************************************************************
+  * @file    pca9685_dma.c
+  * @brief   Non-blocking PCA9685 servo driver, see pca9685_dma.h.
+  ******************************************************************************
+  */
+#include "pca9685_dma.h"
+
+#include <string.h>
+
+// Datasheet link --> https://cdn-shop.adafruit.com/datasheets/PCA9685.pdf
+#define PCA9685_MODE1         0x00
+#define PCA9685_LED0_ON_L     0x06
+#define PCA9685_PRE_SCALE     0xFE
+
+#define PCA9685_MODE1_ALLCALL 0x01
+#define PCA9685_MODE1_SLEEP   0x10
+#define PCA9685_MODE1_AI      0x20
+
+#define PCA9685_LED_FULL      0x10  // bit 4 of LEDn_OFF_H
+
+#define PCA9685_TIMEOUT_MS    10
+
+static PCA9685_DMA_HandleTypeDef *s_boards[PCA9685_DMA_MAX_BOARDS];
+static uint8_t s_boardCount;
+static uint8_t s_next;              // round robin start for the next transfer
+
+static HAL_StatusTypeDef PCA9685_DMA_WriteReg(PCA9685_DMA_HandleTypeDef *hpca, uint8_t reg, uint8_t value)
+{
+  return HAL_I2C_Mem_Write(hpca->hi2c, hpca->Address, reg, I2C_MEMADD_SIZE_8BIT, &value, 1, PCA9685_TIMEOUT_MS);
+}
+
+// Start the next pending frame on `hi2c`. Interrupts off or from the I2C/DMA
+// interrupt, which completes the previous transfer on that bus.
+static void PCA9685_DMA_StartNext(I2C_HandleTypeDef *hi2c)
+{
+  for (uint8_t i = 0; i < s_boardCount; i++)
+  {
+    uint8_t n = (s_next + i) % s_boardCount;
+    PCA9685_DMA_HandleTypeDef *hpca = s_boards[n];
+    if (hpca->hi2c != hi2c || !hpca->Pending)
+      continue;
+
+    memcpy(hpca->Tx, hpca->Next, PCA9685_DMA_FRAME_SIZE);
+    hpca->Pending = 0;
+    s_next = (n + 1) % s_boardCount;
+    if (HAL_I2C_Mem_Write_DMA(hi2c, hpca->Address, PCA9685_LED0_ON_L, I2C_MEMADD_SIZE_8BIT,
+                              hpca->Tx, PCA9685_DMA_FRAME_SIZE) == HAL_OK)
+    {
+      hpca->InFlight = 1;
+      return;
+    }
+
+    hpca->Errors++;
+    if (hpca->FrameDoneCallback)
+      hpca->FrameDoneCallback(hpca, HAL_ERROR);
+  }
+}
+
+static uint8_t PCA9685_DMA_BusBusy(I2C_HandleTypeDef *hi2c)
+{
+  for (uint8_t i = 0; i < s_boardCount; i++)
+  {
+    if (s_boards[i]->hi2c == hi2c && s_boards[i]->InFlight)
+      return 1;
+  }
+  return 0;
+}
+
+static void PCA9685_DMA_Complete(I2C_HandleTypeDef *hi2c, HAL_StatusTypeDef status)
+{
+  for (uint8_t i = 0; i < s_boardCount; i++)
+  {
+    PCA9685_DMA_HandleTypeDef *hpca = s_boards[i];
+    if (hpca->hi2c != hi2c || !hpca->InFlight)
+      continue;
+
+    hpca->InFlight = 0;
+    if (status == HAL_OK)
+      hpca->FramesWritten++;
+    else
+      hpca->Errors++;
+    if (hpca->FrameDoneCallback)
+      hpca->FrameDoneCallback(hpca, status);
+    break;
+  }
+  PCA9685_DMA_StartNext(hi2c);
+}
+
+uint8_t PCA9685_DMA_Prescale(uint16_t frequency)
+{
+  if(frequency >= 1526) return 0x03;
+  if(frequency <= 24) return 0xFF;
+  // round(osc_clock / (4096 * update_rate)) - 1, internal 25 MHz oscillator,
+  // the same value the ESP32 driver writes
+  return (uint8_t)(25000000.0f / (4096.0f * frequency) + 0.5f) - 1;
+}
+
+HAL_StatusTypeDef PCA9685_DMA_Init(PCA9685_DMA_HandleTypeDef *hpca, I2C_HandleTypeDef *hi2c, uint8_t address, uint16_t frequency)
+{
+  if (s_boardCount >= PCA9685_DMA_MAX_BOARDS)
+    return HAL_ERROR;
+
+  memset(hpca, 0, sizeof(*hpca));
+  hpca->hi2c = hi2c;
+  hpca->Address = address << 1;   // HAL uses 8-bit address (shifted)
+  for (uint8_t ch = 0; ch < PCA9685_DMA_CHANNELS; ch++)
+    hpca->Stage[4 * ch + 3] = PCA9685_LED_FULL;
+
+  // MODE1 is written whole from the shadow, never read-modify-written
+  hpca->Mode1 = PCA9685_MODE1_ALLCALL | PCA9685_MODE1_AI;
+  HAL_StatusTypeDef status = PCA9685_DMA_SetPWMFrequency(hpca, frequency);
+  if (status != HAL_OK)
+    return status;
+
+  s_boards[s_boardCount++] = hpca;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef PCA9685_DMA_SetPWMFrequency(PCA9685_DMA_HandleTypeDef *hpca, uint16_t frequency)
+{
+  if (PCA9685_DMA_IsBusy(hpca))
+    return HAL_BUSY;
+
+  uint8_t prescale = PCA9685_DMA_Prescale(frequency);
+
+  // PRE_SCALE can only be written while asleep
+  HAL_StatusTypeDef status = PCA9685_DMA_WriteReg(hpca, PCA9685_MODE1, hpca->Mode1 | PCA9685_MODE1_SLEEP);
+  if (status == HAL_OK)
+    status = PCA9685_DMA_WriteReg(hpca, PCA9685_PRE_SCALE, prescale);
+  if (status == HAL_OK)
+    status = PCA9685_DMA_WriteReg(hpca, PCA9685_MODE1, hpca->Mode1);
+  return status;
+}
+
+void PCA9685_DMA_SetPWM(PCA9685_DMA_HandleTypeDef *hpca, uint8_t channel, uint16_t on, uint16_t off)
+{
+  // See example 1 in the datasheet page no 18/52
+  uint8_t *led = &hpca->Stage[4 * channel];
+  led[0] = on & 0xFF;
+  led[1] = on >> 8;
+  led[2] = off & 0xFF;
+  led[3] = off >> 8;
+}
+
+HAL_StatusTypeDef PCA9685_DMA_Commit(PCA9685_DMA_HandleTypeDef *hpca)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+
+  memcpy(hpca->Next, hpca->Stage, PCA9685_DMA_FRAME_SIZE);
+  if (hpca->Pending)
+    hpca->FramesMerged++;
+  hpca->Pending = 1;
+  if (!PCA9685_DMA_BusBusy(hpca->hi2c))
+    PCA9685_DMA_StartNext(hpca->hi2c);
+
+  __set_PRIMASK(primask);
+  return HAL_OK;
+}
+
+uint8_t PCA9685_DMA_IsBusy(const PCA9685_DMA_HandleTypeDef *hpca)
+{
+  return hpca->Pending || hpca->InFlight;
+}
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+  PCA9685_DMA_Complete(hi2c, HAL_OK);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+  PCA9685_DMA_Complete(hi2c, HAL_ERROR);
+}
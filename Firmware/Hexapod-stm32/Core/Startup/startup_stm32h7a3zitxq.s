@@ -94,7 +94,54 @@ FillZerobss:
 LoopFillZerobss:
   cmp r2, r4
   bcc FillZerobss
-  
+
+/* Copy the motion core code to ITCM and its tables to DTCM, zero its DTCM
+   bss. Before the static constructors: they build the legs and gait tables. */
+  ldr r0, =_sitcm
+  ldr r1, =_eitcm
+  ldr r2, =_siitcm
+  movs r3, #0
+  b LoopCopyItcm
+
+CopyItcm:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopyItcm:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopyItcm
+
+  ldr r0, =_sdtcm
+  ldr r1, =_edtcm
+  ldr r2, =_sidtcm
+  movs r3, #0
+  b LoopCopyDtcm
+
+CopyDtcm:
+  ldr r4, [r2, r3]
+  str r4, [r0, r3]
+  adds r3, r3, #4
+
+LoopCopyDtcm:
+  adds r4, r0, r3
+  cmp r4, r1
+  bcc CopyDtcm
+
+  ldr r2, =_sdtcm_bss
+  ldr r4, =_edtcm_bss
+  movs r3, #0
+  b LoopFillZeroDtcm
+
+FillZeroDtcm:
+  str  r3, [r2]
+  adds r2, r2, #4
+
+LoopFillZeroDtcm:
+  cmp r2, r4
+  bcc FillZeroDtcm
+
 /* Call static constructors */
     bl __libc_init_array
 /* Call the application's entry point.*/
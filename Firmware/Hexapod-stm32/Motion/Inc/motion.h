@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    motion.h
+  * @brief   Real-time motion core of the STM32 port: the ESP32 gait and IK
+  *          engine run from the TIM6 update interrupt, one frame per tick.
+  ******************************************************************************
+  */
+#ifndef __MOTION_H__
+#define __MOTION_H__
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Control tick in ms, config::movementInterval like the ESP32 loop. */
+#ifndef MOTION_TICK_MS
+#define MOTION_TICK_MS   20
+#endif
+
+typedef struct
+{
+  uint32_t Ticks;
+  uint32_t Overruns;     /*!< ticks that ran into the next TIM6 update */
+  uint32_t LastCycles;   /*!< CPU cycles of the last frame (DWT) */
+  uint32_t MaxCycles;
+  uint8_t Mode;          /*!< MovementMode the gait runs */
+  uint8_t Direct;        /*!< 1 while Motion_SetJoints() overrides the gait */
+} Motion_StatsTypeDef;
+
+/**
+  * @brief  Initialize the servo boards and put the legs in standby, blocking.
+  *         Call after MX_I2C2_Init() and MX_TIM6_Init().
+  */
+void Motion_Init(void);
+
+/** @brief Start the control tick, TIM6 fires every MOTION_TICK_MS. */
+void Motion_Start(void);
+
+/*
+ * Commands, taken over at the next tick. Call them from thread context (the
+ * main loop), not from an interrupt above the TIM6 priority.
+ */
+
+/** @brief Request a MovementMode, also ends a Motion_SetJoints() override. */
+void Motion_SetMode(int mode);
+
+/** @brief Gait speed, config::minSpeed .. config::maxSpeed. */
+void Motion_SetSpeed(float speed);
+
+/** @brief Body pose applied on top of the gait, degrees and mm. */
+void Motion_SetBodyPose(float roll, float pitch, float yaw, float x, float y, float z);
+
+/**
+  * @brief  Drive the 18 joints directly (leg * 3 + joint, degrees) instead of
+  *         the gait, every tick until the next Motion_SetMode().
+  */
+void Motion_SetJoints(const float angles[18]);
+
+/** @brief One control frame, called from the TIM6 period elapsed callback. */
+void Motion_Tick(void);
+
+void Motion_GetStats(Motion_StatsTypeDef *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __MOTION_H__ */
@@ -0,0 +1,28 @@
+// STM32 port shim: the ESP-IDF `driver/i2c_master.h` types pca9685.h and
+// servo_topology.h name. Nothing here is called, the boards are driven by
+// pca9685_dma.c on I2C2.
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    GPIO_NUM_NC = -1,
+    GPIO_NUM_8 = 8,
+    GPIO_NUM_9 = 9,
+} gpio_num_t;
+
+typedef int i2c_port_num_t;
+
+#define I2C_NUM_0   0
+#define I2C_NUM_1   1
+
+typedef struct i2c_master_bus_t *i2c_master_bus_handle_t;
+typedef struct i2c_master_dev_t *i2c_master_dev_handle_t;
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,22 @@
+// STM32 port shim: subset of ESP-IDF esp_err.h used by the motion components.
+#pragma once
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void Error_Handler(void);
+
+typedef int esp_err_t;
+
+#define ESP_OK                  0
+#define ESP_FAIL                -1
+
+#define ESP_ERROR_CHECK(x) do {                                              \
+        if ((x) != ESP_OK)                                                   \
+            Error_Handler();                                                 \
+    } while (0)
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,21 @@
+// STM32 port shim: the ESP-IDF log levels and ESP_LOGx macros the motion
+// components use. There is no console on the control path, so they compile
+// to nothing.
+#pragma once
+
+typedef enum {
+    ESP_LOG_NONE,
+    ESP_LOG_ERROR,
+    ESP_LOG_WARN,
+    ESP_LOG_INFO,
+    ESP_LOG_DEBUG,
+    ESP_LOG_VERBOSE,
+} esp_log_level_t;
+
+#define ESP_LOGE(tag, format, ...) do { } while (0)
+#define ESP_LOGW(tag, format, ...) do { } while (0)
+#define ESP_LOGI(tag, format, ...) do { } while (0)
+#define ESP_LOGD(tag, format, ...) do { } while (0)
+#define ESP_LOGV(tag, format, ...) do { } while (0)
+
+#define ESP_LOG_LEVEL(level, tag, format, ...) do { } while (0)
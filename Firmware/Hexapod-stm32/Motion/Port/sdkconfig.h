@@ -0,0 +1,4 @@
+// STM32 port shim: stands in for the sdkconfig.h generated by menuconfig.
+// The motion components see the ESP32 defaults (libm IK, all boards on one
+// bus) unless the options are passed as compile definitions.
+#pragma once
@@ -0,0 +1,182 @@
+// Motion core of the STM32 port. The legs, gait tables, IK and servo tick
+// tables are the ESP32 components compiled unchanged; this file only owns the
+// state HexapodClass owns there and steps it from the TIM6 interrupt.
+
+#include "main.h"
+#include "tim.h"
+#include "motion.h"
+#include "motion_frame.h"
+
+using namespace hexapod;
+
+namespace {
+
+Leg legs[6] = {{0}, {1}, {2}, {3}, {4}, {5}};
+Movement movement{MOVEMENT_STANDBY};
+BodyPose bodyPose{};
+MovementMode mode = MOVEMENT_STANDBY;
+
+volatile int requested = MOVEMENT_STANDBY;
+Motion_StatsTypeDef stats;
+
+// Commands from the main loop. Written with interrupts off, the tick reads
+// them unguarded since nothing below its priority can run in between.
+struct Commands {
+  bool speedSet;
+  bool poseSet;
+  bool jointsSet;
+  bool release;
+  float speed;
+  BodyPose pose;
+  float joints[18];
+};
+Commands commands;
+
+bool direct = false;
+float joints[18];
+
+uint32_t lastStart;
+
+} // namespace
+
+extern "C" void Motion_Init(void)
+{
+  // frame timing, the H7 needs the DWT unlocked before CYCCNT counts
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->LAR = 0xC5ACCE55;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  Servo::init();
+
+  // elapsed 0 completes the standby step at once, like HexapodClass::init()
+  motionFrame(movement, bodyPose, legs, 0);
+}
+
+extern "C" void Motion_Start(void)
+{
+  // 1 MHz counter, see MX_TIM6_Init()
+  __HAL_TIM_SET_AUTORELOAD(&htim6, MOTION_TICK_MS * 1000 - 1);
+  __HAL_TIM_CLEAR_FLAG(&htim6, TIM_FLAG_UPDATE);
+  lastStart = DWT->CYCCNT;
+  if (HAL_TIM_Base_Start_IT(&htim6) != HAL_OK)
+  {
+    Error_Handler();
+  }
+}
+
+extern "C" void Motion_SetMode(int m)
+{
+  if (m < MOVEMENT_STANDBY || m >= MOVEMENT_TOTAL)
+    return;
+
+  __disable_irq();
+  requested = m;
+  commands.release = true;
+  commands.jointsSet = false;
+  __enable_irq();
+}
+
+extern "C" void Motion_SetSpeed(float speed)
+{
+  __disable_irq();
+  commands.speed = speed;
+  commands.speedSet = true;
+  __enable_irq();
+}
+
+extern "C" void Motion_SetBodyPose(float roll, float pitch, float yaw, float x, float y, float z)
+{
+  __disable_irq();
+  commands.pose = BodyPose{roll, pitch, yaw, x, y, z};
+  commands.poseSet = true;
+  __enable_irq();
+}
+
+extern "C" void Motion_SetJoints(const float angles[18])
+{
+  __disable_irq();
+  for (int i = 0; i < 18; i++)
+    commands.joints[i] = angles[i];
+  commands.jointsSet = true;
+  commands.release = false;
+  __enable_irq();
+}
+
+static void takeCommands()
+{
+  if (commands.speedSet)
+  {
+    commands.speedSet = false;
+    movement.setSpeed(commands.speed);
+  }
+  if (commands.poseSet)
+  {
+    commands.poseSet = false;
+    bodyPose = commands.pose;
+  }
+  if (commands.jointsSet)
+  {
+    commands.jointsSet = false;
+    for (int i = 0; i < 18; i++)
+      joints[i] = commands.joints[i];
+    direct = true;
+  }
+  else if (commands.release && direct)
+  {
+    // the servos moved behind the legs' back, make the gait rewrite them
+    direct = false;
+    for (Leg& leg : legs)
+      leg.forceResetTipPosition();
+  }
+  commands.release = false;
+}
+
+extern "C" void Motion_Tick(void)
+{
+  uint32_t start = DWT->CYCCNT;
+
+  // the gait clock runs on the cycle counter, so a tick that came late (or a
+  // lost period) moves the gait by the time that really passed
+  uint32_t elapsedUs = (start - lastStart) / (SystemCoreClock / 1000000);
+  lastStart = start;
+
+  takeCommands();
+  if (mode != requested)
+  {
+    mode = (MovementMode)requested;
+    movement.setMode(mode);
+  }
+
+  if (direct)
+  {
+    for (int i = 0; i < 6; i++)
+      for (int j = 0; j < 3; j++)
+        legs[i].get(j)->setAngle(joints[i * 3 + j]);
+    Servo::commit();
+  }
+  else
+  {
+    motionFrame(movement, bodyPose, legs, elapsedUs);
+  }
+
+  uint32_t cycles = DWT->CYCCNT - start;
+  stats.Ticks++;
+  stats.Mode = mode;
+  stats.Direct = direct;
+  stats.LastCycles = cycles;
+  if (cycles > stats.MaxCycles)
+    stats.MaxCycles = cycles;
+
+  // HAL cleared the update flag before calling us, set again means the next
+  // tick is already due and this frame's period was lost
+  if (__HAL_TIM_GET_FLAG(&htim6, TIM_FLAG_UPDATE))
+    stats.Overruns++;
+}
+
+extern "C" void Motion_GetStats(Motion_StatsTypeDef *out)
+{
+  __disable_irq();
+  *out = stats;
+  __enable_irq();
+}
@@ -0,0 +1,79 @@
+// Servo output of the STM32 port, replaces servo_bus.cpp and servo_output.cpp
+// of the ESP32 build. All boards of the topology hang on I2C2 and are written
+// by pca9685_dma.c, one whole-board DMA frame per commit; servo.cpp is shared
+// as is, so the H7 sends the same off ticks as the ESP32.
+
+#include "i2c.h"
+#include "pca9685_dma.h"
+#include "servo.h"
+#include "servo_bus.h"
+
+namespace hexapod {
+
+namespace {
+
+// The handles are DMA sources, they stay in AXI SRAM (see pca9685_dma.h)
+PCA9685_DMA_HandleTypeDef boards[servo_bus::kBoards];
+pca9685_frame_stats_t stats;
+bool inited = false;
+
+} // namespace
+
+void Servo::init() {
+    if (inited)
+        return;
+
+    for (int b = 0; b < servo_bus::kBoards; b++) {
+        if (PCA9685_DMA_Init(&boards[b], &hi2c2, topology::kBoards[b].address, servo_bus::kFrequency) != HAL_OK)
+            Error_Handler();
+    }
+    inited = true;
+}
+
+void Servo::commit() {
+    servo_bus::Frame& frame = servo_bus::staged;
+
+    for (int b = 0; b < servo_bus::kBoards; b++) {
+        stats.commits++;
+        uint16_t set = frame.set[b];
+        if (!set) {
+            stats.skipped++;
+            continue;
+        }
+
+        while (set) {
+            int n = __builtin_ctz(set);
+            set &= set - 1;
+            PCA9685_DMA_SetPWM(&boards[b], n, 0, frame.off[b * PCA9685_CHANNELS + n]);
+            stats.channels_set++;
+        }
+        frame.set[b] = 0;
+
+        // the DMA driver always sends LED0_ON_L..LED15_OFF_H in one transfer
+        if (PCA9685_DMA_Commit(&boards[b]) != HAL_OK)
+            continue;
+        stats.transactions++;
+        stats.bytes += 2 + PCA9685_DMA_FRAME_SIZE;
+        stats.channels_written += PCA9685_CHANNELS;
+    }
+}
+
+pca9685_frame_stats_t Servo::outputStats() {
+    return stats;
+}
+
+void Servo::resetOutputStats() {
+    stats = {};
+}
+
+} // namespace hexapod
+
+// servo.cpp sizes its tick table from these, same rounding as the ESP32
+// driver and the PRE_SCALE pca9685_dma.c writes
+uint8_t pca9685_prescale(uint16_t freq) {
+    return PCA9685_DMA_Prescale(freq);
+}
+
+float pca9685_tick_us(uint16_t freq) {
+    return (pca9685_prescale(freq) + 1) * (1000000.0f / (float)CLOCK_FREQ);
+}